@@ -16,6 +16,7 @@
 import asyncio
 from typing import Awaitable
 
+from acouchbase.logic import wait_for_rows
 from couchbase.exceptions import (PYCBC_ERROR_MAP,
                                   AlreadyQueriedException,
                                   CouchbaseException,
@@ -77,8 +78,12 @@ class AsyncAnalyticsRequest(AnalyticsRequestLogic):
 
     async def _get_next_row(self):
         if self.done_streaming is True:
-            return
+            raise StopAsyncIteration
 
+        await wait_for_rows(self._loop, self._streaming_result)
+        # cancelled while waiting
+        if self.done_streaming is True:
+            raise StopAsyncIteration
         row = next(self._streaming_result)
         if isinstance(row, CouchbaseBaseException):
             raise ErrorMapper.build_exception(row)
@@ -97,6 +102,9 @@ class AsyncAnalyticsRequest(AnalyticsRequestLogic):
             excptn = exc_cls('Unexpected QueueEmpty exception caught when doing Analytics query.')
             raise excptn
         except StopAsyncIteration:
+            # already done (or cancelled, in which case there is no metadata)
+            if self.done_streaming:
+                raise
             self._done_streaming = True
             self._get_metadata()
             raise
@@ -27,7 +27,9 @@ from typing import (TYPE_CHECKING,
 from acouchbase import get_event_loop
 from acouchbase.analytics import AnalyticsQuery, AsyncAnalyticsRequest
 from acouchbase.bucket import AsyncBucket
-from acouchbase.logic import AsyncWrapper
+from acouchbase.logic import (AsyncWrapper,
+                              register_async_cluster,
+                              release_async_completions)
 from acouchbase.management.analytics import AnalyticsIndexManager
 from acouchbase.management.buckets import BucketManager
 from acouchbase.management.eventing import EventingFunctionManager
@@ -134,6 +136,7 @@ class AsyncCluster(ClusterLogic):
         """
         **INTERNAL**
         """
+        register_async_cluster(self._loop, self)
         super()._connect_cluster(**kwargs)
 
     def on_connect(self) -> Awaitable:
@@ -178,6 +181,7 @@ class AsyncCluster(ClusterLogic):
 
         await self._close_ftr
         super()._destroy_connection()
+        release_async_completions(self._loop, self)
 
     def bucket(self, bucket_name) -> AsyncBucket:
         """Creates a Bucket instance to a specific bucket.
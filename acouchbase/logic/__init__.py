@@ -15,3 +15,6 @@
 
 from .wrappers import AsyncWrapper  # noqa: F401
 from .wrappers import call_async_fn  # noqa: F401
+from .wrappers import register_async_cluster  # noqa: F401
+from .wrappers import release_async_completions  # noqa: F401
+from .wrappers import wait_for_rows  # noqa: F401
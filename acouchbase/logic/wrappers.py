@@ -16,6 +16,7 @@
 from __future__ import annotations
 
 from functools import partial, wraps
+from weakref import WeakKeyDictionary, WeakSet
 
 from couchbase.exceptions import (PYCBC_ERROR_MAP,
                                   CouchbaseException,
@@ -26,6 +27,103 @@ from couchbase.exceptions import (PYCBC_ERROR_MAP,
                                   MissingConnectionException,
                                   ServiceUnavailableException)
 from couchbase.logic import decode_replicas, decode_value
+from couchbase.pycbc_core import async_completions
+
+# event loop -> async_completions (None if the loop cannot watch its descriptor, e.g. the Windows proactor loop)
+_COMPLETIONS = WeakKeyDictionary()
+# event loop -> clusters connected on it, the loop's completion queue is unregistered once the last one closes
+_LOOP_CLUSTERS = WeakKeyDictionary()
+
+
+def get_async_completions(loop):
+    """
+    **INTERNAL**
+
+    The loop's completion queue, created (and registered w/ add_reader()) on first use.  Operations hand
+    ``completions.completion(future, ...)`` to the C++ client as callback and errback, their futures are then
+    resolved in bulk when the loop drains the queue instead of through a call_soon_threadsafe() per operation.
+    """
+    try:
+        return _COMPLETIONS[loop]
+    except KeyError:
+        pass
+    completions = None
+    try:
+        completions = async_completions(ErrorMapper.build_exception)
+        loop.add_reader(completions.fileno(), completions.drain)
+    except (NotImplementedError, OSError):
+        completions = None
+    _COMPLETIONS[loop] = completions
+    return completions
+
+
+def register_async_cluster(loop, cluster):
+    """
+    **INTERNAL**
+
+    Record that cluster is connected on loop, see :func:`release_async_completions`.
+    """
+    clusters = _LOOP_CLUSTERS.get(loop)
+    if clusters is None:
+        clusters = WeakSet()
+        _LOOP_CLUSTERS[loop] = clusters
+    clusters.add(cluster)
+
+
+def release_async_completions(loop, cluster):
+    """
+    **INTERNAL**
+
+    Called once cluster has closed.  When no other cluster is connected on loop, whatever is still queued is
+    resolved and the loop's completion queue is removed from the loop (remove_reader()) and dropped.
+    """
+    clusters = _LOOP_CLUSTERS.get(loop)
+    if clusters is not None:
+        clusters.discard(cluster)
+        if len(clusters) > 0:
+            return
+        del _LOOP_CLUSTERS[loop]
+
+    completions = _COMPLETIONS.pop(loop, None)
+    if completions is None:
+        return
+    try:
+        loop.remove_reader(completions.fileno())
+    except (NotImplementedError, OSError, RuntimeError):
+        # the loop is already closed
+        pass
+    completions.drain()
+
+
+async def wait_for_rows(loop, streamed_result):
+    """
+    **INTERNAL**
+
+    Wait, w/o blocking the loop, until the next ``next(streamed_result)`` call has a row to return.
+    """
+    completions = get_async_completions(loop)
+    if completions is None:
+        return
+    ft = loop.create_future()
+    if completions.watch_rows(streamed_result, ft):
+        await ft
+
+
+def _no_result(res):
+    return None
+
+
+def _result_converter(return_cls):
+    """
+    **INTERNAL**
+
+    Converter handed to async_completions.completion(), matching the return_cls handling of the on_ok callbacks.
+    """
+    if return_cls is None:
+        return _no_result
+    if return_cls is True:
+        return None
+    return return_cls
 
 
 def call_async_fn(ft, self, fn, *args, **kwargs):
@@ -223,26 +321,33 @@ class AsyncWrapper:
     def inject_callbacks(cls, return_cls):   # noqa: C901
 
         def decorator(fn):
+            converter = _result_converter(return_cls)
+
             @wraps(fn)
             def wrapped_fn(self, *args, **kwargs):
                 ft = self.loop.create_future()
+                completions = get_async_completions(self.loop)
+                if completions is not None:
+                    completion = completions.completion(ft, converter)
+                    kwargs["callback"] = completion
+                    kwargs["errback"] = completion
+                else:
+                    def on_ok(res):
+                        if return_cls is None:
+                            retval = None
+                        elif return_cls is True:
+                            retval = res
+                        else:
+                            retval = return_cls(res)
 
-                def on_ok(res):
-                    if return_cls is None:
-                        retval = None
-                    elif return_cls is True:
-                        retval = res
-                    else:
-                        retval = return_cls(res)
-
-                    self.loop.call_soon_threadsafe(ft.set_result, retval)
+                        self.loop.call_soon_threadsafe(ft.set_result, retval)
 
-                def on_err(exc):
-                    excptn = ErrorMapper.build_exception(exc)
-                    self.loop.call_soon_threadsafe(ft.set_exception, excptn)
+                    def on_err(exc):
+                        excptn = ErrorMapper.build_exception(exc)
+                        self.loop.call_soon_threadsafe(ft.set_exception, excptn)
 
-                kwargs["callback"] = on_ok
-                kwargs["errback"] = on_err
+                    kwargs["callback"] = on_ok
+                    kwargs["errback"] = on_err
 
                 if not self._connection:
                     bucket_conn_ft = self._scope._connect_bucket()
@@ -267,45 +372,52 @@ class AsyncWrapper:
     def inject_callbacks_and_decode(cls, return_cls):   # noqa: C901
 
         def decorator(fn):
+            is_all_replicas = fn.__name__ == '_get_all_replicas_internal'
+            is_subdoc = fn.__name__ == '_lookup_in_internal'
+
+            def decode(res, transcoder):
+                try:
+                    # special case for get_all_replicas
+                    if is_all_replicas:
+                        return decode_replicas(transcoder, res, return_cls)
+
+                    value = res.raw_result.get('value', None)
+                    flags = res.raw_result.get('flags', None)
+                    res.raw_result['value'] = decode_value(transcoder, value, flags, is_subdoc=is_subdoc)
+
+                    if return_cls is None:
+                        return None
+                    elif return_cls is True:
+                        return res
+                    return return_cls(res)
+                except CouchbaseException:
+                    raise
+                except Exception as ex:
+                    exc_cls = PYCBC_ERROR_MAP.get(ExceptionMap.InternalSDKException.value, CouchbaseException)
+                    raise exc_cls(message=str(ex)) from None
+
             @wraps(fn)
             def wrapped_fn(self, *args, **kwargs):
                 ft = self.loop.create_future()
                 transcoder = kwargs.pop('transcoder')
+                completions = get_async_completions(self.loop)
+                if completions is not None:
+                    completion = completions.completion(ft, decode, transcoder)
+                    kwargs["callback"] = completion
+                    kwargs["errback"] = completion
+                else:
+                    def on_ok(res):
+                        try:
+                            self.loop.call_soon_threadsafe(ft.set_result, decode(res, transcoder))
+                        except CouchbaseException as e:
+                            self.loop.call_soon_threadsafe(ft.set_exception, e)
 
-                def on_ok(res):
-                    try:
-                        # special case for get_all_replicas
-                        if fn.__name__ == '_get_all_replicas_internal':
-                            self.loop.call_soon_threadsafe(ft.set_result,
-                                                           decode_replicas(transcoder, res, return_cls))
-                            return
-
-                        value = res.raw_result.get('value', None)
-                        flags = res.raw_result.get('flags', None)
-
-                        is_suboc = fn.__name__ == '_lookup_in_internal'
-                        res.raw_result['value'] = decode_value(transcoder, value, flags, is_subdoc=is_suboc)
-
-                        if return_cls is None:
-                            retval = None
-                        elif return_cls is True:
-                            retval = res
-                        else:
-                            retval = return_cls(res)
-                        self.loop.call_soon_threadsafe(ft.set_result, retval)
-                    except CouchbaseException as e:
-                        self.loop.call_soon_threadsafe(ft.set_exception, e)
-                    except Exception as ex:
-                        exc_cls = PYCBC_ERROR_MAP.get(ExceptionMap.InternalSDKException.value, CouchbaseException)
-                        excptn = exc_cls(message=str(ex))
+                    def on_err(exc):
+                        excptn = ErrorMapper.build_exception(exc)
                         self.loop.call_soon_threadsafe(ft.set_exception, excptn)
 
-                def on_err(exc):
-                    excptn = ErrorMapper.build_exception(exc)
-                    self.loop.call_soon_threadsafe(ft.set_exception, excptn)
-
-                kwargs["callback"] = on_ok
-                kwargs["errback"] = on_err
+                    kwargs["callback"] = on_ok
+                    kwargs["errback"] = on_err
 
                 if not self._connection:
                     bucket_conn_ft = self._scope._connect_bucket()
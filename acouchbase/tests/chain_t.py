@@ -14,6 +14,7 @@
 #  limitations under the License.
 
 import asyncio
+import gc
 
 import pytest
 import pytest_asyncio
@@ -22,6 +23,7 @@ from acouchbase.bucket import AsyncBucket
 from acouchbase.cluster import (AsyncCluster,
                                 Cluster,
                                 get_event_loop)
+from acouchbase.logic.wrappers import _COMPLETIONS
 from couchbase.auth import PasswordAuthenticator
 from couchbase.options import ClusterOptions
 from couchbase.result import GetResult
@@ -82,4 +84,31 @@ class ConnectionChainingTests:
         assert isinstance(res, GetResult)
         assert res.content_as[dict] == doc
 
+    @pytest.mark.asyncio
+    async def test_close_releases_completions(self, couchbase_config):
+        conn_string = couchbase_config.get_connection_string()
+        username, pw = couchbase_config.get_username_and_pw()
+
+        # clusters left open by the other tests are no longer referenced
+        gc.collect()
+        auth = PasswordAuthenticator(username, pw)
+        clusters = [await Cluster.connect(conn_string, ClusterOptions(auth)) for _ in range(2)]
+        loop = clusters[0].loop
+        key = 'async-test-conn-key'
+        doc = {'id': key, 'what': 'this is an asyncio test.'}
+        for cluster in clusters:
+            coll = cluster.bucket(couchbase_config.bucket_name).default_collection()
+            await coll.upsert(key, doc)
+
+        completions = _COMPLETIONS.get(loop)
+        assert completions is not None
+        await clusters[0].close()
+        # still watched for the other cluster
+        assert _COMPLETIONS.get(loop) is completions
+        res = await clusters[1].bucket(couchbase_config.bucket_name).default_collection().get(key)
+        assert res.content_as[dict] == doc
+
+        await clusters[1].close()
+        assert loop not in _COMPLETIONS
+
     # @TODO(jc): PYCBC-1414 - once complete, validate cluster operations chaining
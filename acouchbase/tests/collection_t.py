@@ -178,6 +178,21 @@ class CollectionTests:
         with pytest.raises(DocumentNotFoundException):
             await cb.get(self.NO_KEY)
 
+    @pytest.mark.asyncio
+    async def test_get_concurrent(self, cb_env, default_kvp):
+        cb = cb_env.collection
+        key = default_kvp.key
+        value = default_kvp.value
+        # completions are handed to the loop in bulk, each future has to get its own outcome
+        results = await asyncio.gather(*[cb.get(key if i % 2 == 0 else self.NO_KEY) for i in range(100)],
+                                       return_exceptions=True)
+        for i, result in enumerate(results):
+            if i % 2 == 0:
+                assert isinstance(result, GetResult)
+                assert result.content_as[dict] == value
+            else:
+                assert isinstance(result, DocumentNotFoundException)
+
     @pytest.mark.usefixtures("check_xattr_supported")
     @pytest.mark.asyncio
     async def test_get_with_expiry(self, cb_env, new_kvp):
@@ -129,6 +129,17 @@ class SubDocumentTests:
         assert isinstance(result, LookupInResult)
         assert result.content_as[dict](0) == value["geo"]
 
+    @pytest.mark.asyncio
+    async def test_lookup_in_invalid_spec(self, cb_env, default_kvp):
+        cb = cb_env.collection
+        key = default_kvp.key
+        # a compiled mutate_in spec only fails once the C++ client parses it
+        spec = SD.CompiledSpec([SD.upsert('city', 'New City')])
+        with pytest.raises(InvalidArgumentException):
+            await cb.lookup_in(key, spec)
+        with pytest.raises(InvalidArgumentException):
+            await cb.mutate_in(key, SD.CompiledSpec([SD.get('city')]))
+
     @pytest.mark.asyncio
     async def test_lookup_in_simple_exists(self, cb_env, default_kvp):
         cb = cb_env.collection
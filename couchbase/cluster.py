@@ -19,8 +19,11 @@ import time
 from datetime import timedelta
 from typing import (TYPE_CHECKING,
                     Any,
-                    Dict)
+                    Dict,
+                    Iterable,
+                    Optional)
 
+from couchbase._utils import timedelta_as_microseconds
 from couchbase.analytics import AnalyticsQuery, AnalyticsRequest
 from couchbase.bucket import Bucket
 from couchbase.diagnostics import ClusterState, ServiceType
@@ -37,6 +40,7 @@ from couchbase.management.search import SearchIndexManager
 from couchbase.management.users import UserManager
 from couchbase.n1ql import N1QLQuery, N1QLRequest
 from couchbase.options import PingOptions, forward_args
+from couchbase.pycbc_core import prepare_statements
 from couchbase.result import (AnalyticsResult,
                               ClusterInfoResult,
                               DiagnosticsResult,
@@ -387,6 +391,49 @@ class Cluster(ClusterLogic):
                                                              query.params,
                                                              default_serializer=self.default_serializer))
 
+    def prepare_statements(self,
+                           statements,  # type: Iterable[str]
+                           query_context=None,  # type: Optional[str]
+                           timeout=None  # type: Optional[timedelta]
+                           ) -> Dict[str, Exception]:
+        """**VOLATILE** This API is subject to change at any time.
+
+        Prepares the provided N1QL statements and keeps their names in the prepared statement cache, so that their
+        first query w/ ``adhoc=False`` does not need to prepare them (e.g. to warm up the cache after a deploy).
+        The statements are prepared concurrently.
+
+        .. note::
+            Requires the ``prepared_statement_cache_size`` cluster option.
+
+        Args:
+            statements (Iterable[str]): The statements to prepare, exactly as they will be queried.
+            query_context (str, optional): The query context the statements will be queried in, e.g.
+                ``default:`bucket-name`.`scope-name``` for :meth:`~couchbase.scope.Scope.query`.
+            timeout (timedelta, optional): Timeout of each PREPARE request. Defaults to the query timeout.
+
+        Returns:
+            Dict[str, Exception]: The statements that could not be prepared, w/ the reason.  Empty if all
+            statements have been prepared.
+
+        Example::
+
+            failed = cluster.prepare_statements(['SELECT * FROM `travel-sample` WHERE type=$1'])
+            q_res = cluster.query('SELECT * FROM `travel-sample` WHERE type=$1',
+                                  QueryOptions(adhoc=False, positional_parameters=['airline']))
+
+        """
+        prepare_kwargs = {
+            'conn': self.connection,
+            'statements': list(statements),
+        }
+        if query_context is not None:
+            prepare_kwargs['query_context'] = query_context
+        if timeout is not None:
+            prepare_kwargs['timeout'] = timedelta_as_microseconds(timeout)
+
+        failed = prepare_statements(**prepare_kwargs)
+        return {statement: ErrorMapper.build_exception(exc) for statement, exc in failed.items()}
+
     def analytics_query(
         self,  # type: Cluster
         statement,  # type: str
@@ -26,6 +26,7 @@ from typing import (TYPE_CHECKING,
                     Union)
 
 from couchbase.binary_collection import BinaryCollection
+from couchbase.collection_handle import CollectionHandle
 from couchbase.datastructures import (CouchbaseList,
                                       CouchbaseMap,
                                       CouchbaseQueue,
@@ -37,8 +38,12 @@ from couchbase.exceptions import (DocumentExistsException,
                                   QueueEmpty)
 from couchbase.exceptions import exception as CouchbaseBaseException
 from couchbase.logic import (BlockingWrapper,
+                             apply_miss_as_none,
+                             decode_multi_stream,
                              decode_replicas,
-                             decode_value)
+                             decode_result_value,
+                             decode_value,
+                             supports_native_decode)
 from couchbase.logic.collection import CollectionLogic
 from couchbase.logic.supportability import Supportability
 from couchbase.management.queries import CollectionQueryIndexManager
@@ -51,6 +56,8 @@ from couchbase.options import (AppendMultiOptions,
                                IncrementMultiOptions,
                                InsertMultiOptions,
                                LockMultiOptions,
+                               LookupInMultiOptions,
+                               MutateInMultiOptions,
                                PrependMultiOptions,
                                RemoveMultiOptions,
                                ReplaceMultiOptions,
@@ -60,9 +67,13 @@ from couchbase.options import (AppendMultiOptions,
                                forward_args,
                                get_valid_multi_args)
 from couchbase.pycbc_core import (binary_multi_operation,
+                                  kv_bulk_operation,
                                   kv_multi_operation,
-                                  operations)
-from couchbase.result import (CounterResult,
+                                  miss_result,
+                                  operations,
+                                  subdoc_multi_operation)
+from couchbase.result import (BulkMutationResult,
+                              CounterResult,
                               ExistsResult,
                               GetReplicaResult,
                               GetResult,
@@ -71,11 +82,14 @@ from couchbase.result import (CounterResult,
                               MultiExistsResult,
                               MultiGetReplicaResult,
                               MultiGetResult,
+                              MultiLookupInResult,
+                              MultiMutateInResult,
                               MultiMutationResult,
                               MutateInResult,
                               MutationResult,
                               OperationResult)
-from couchbase.subdocument import (array_addunique,
+from couchbase.subdocument import (CompiledSpec,
+                                   array_addunique,
                                    array_append,
                                    array_prepend,
                                    count)
@@ -131,11 +145,12 @@ class Collection(CollectionLogic):
                 override provided :class:`~couchbase.options.GetOptions`
 
         Returns:
-            :class:`~couchbase.result.GetResult`: An instance of :class:`~couchbase.result.GetResult`.
+            :class:`~couchbase.result.GetResult`: An instance of :class:`~couchbase.result.GetResult`, or None if
+                the key provided does not exist and the *miss_as_none* option is set.
 
         Raises:
             :class:`~couchbase.exceptions.DocumentNotFoundException`: If the key provided does not exist
-                on the server.
+                on the server (and the *miss_as_none* option is not set).
 
         Examples:
 
@@ -165,6 +180,7 @@ class Collection(CollectionLogic):
         if not transcoder:
             transcoder = self.default_transcoder
         final_args['transcoder'] = transcoder
+        apply_miss_as_none(final_args)
 
         return self._get_internal(key, **final_args)
 
@@ -854,8 +870,8 @@ class Collection(CollectionLogic):
 
         Args:
             key (str): The key for the document look in.
-            spec (Iterable[:class:`~couchbase.subdocument.Spec`]):  A list of specs describing the data to fetch
-                from the document.
+            spec (Union[Iterable[:class:`~couchbase.subdocument.Spec`], :class:`~couchbase.subdocument.CompiledSpec`]):
+                A list of specs describing the data to fetch from the document.
             opts (:class:`~couchbase.options.LookupInOptions`): Optional parameters for this operation.
             **kwargs (Dict[str, Any]): keyword arguments that can be used in place or to
                 override provided :class:`~couchbase.options.LookupInOptions`
@@ -933,8 +949,8 @@ class Collection(CollectionLogic):
 
         Args:
             key (str): The key for the document look in.
-            spec (Iterable[:class:`~couchbase.subdocument.Spec`]):  A list of specs describing the operations to
-                perform on the document.
+            spec (Union[Iterable[:class:`~couchbase.subdocument.Spec`], :class:`~couchbase.subdocument.CompiledSpec`]):
+                A list of specs describing the operations to perform on the document.
             opts (:class:`~couchbase.options.MutateInOptions`): Optional parameters for this operation.
             **kwargs (Dict[str, Any]): keyword arguments that can be used in place or to
                 override provided :class:`~couchbase.options.MutateInOptions`
@@ -991,6 +1007,34 @@ class Collection(CollectionLogic):
         """
         return BinaryCollection(self)
 
+    def handle(self,
+               transcoder=None,  # type: Optional[Transcoder]
+               ) -> CollectionHandle:
+        """Creates a CollectionHandle, key-value operations bound to this collection that skip per call options
+        parsing.  Meant for hot loops of plain get/exists/upsert/insert/replace/remove calls.
+
+        .. seealso::
+            :class:`~couchbase.collection_handle.CollectionHandle`
+
+        Args:
+            transcoder (:class:`~couchbase.transcoder.Transcoder`, optional): Transcoder used by the handle's
+                operations, defaults to the collection's transcoder.
+
+        Returns:
+            :class:`~couchbase.collection_handle.CollectionHandle`: A CollectionHandle instance.
+
+        Examples:
+
+            Simple get operations through a handle::
+
+                handle = collection.handle()
+                for key in keys:
+                    res = handle.get(key, timedelta(seconds=2))
+                    print(f'Document value: {res.content_as[dict]}')
+
+        """
+        return CollectionHandle(self, transcoder=transcoder)
+
     @BlockingWrapper.block(MutationResult)
     def _append(
         self,
@@ -1660,6 +1704,116 @@ class Collection(CollectionLogic):
         return_exceptions = final_args.pop('return_exceptions', True)
         return op_args, return_exceptions
 
+    def _bulk_mutation(
+        self,
+        op_type,  # type: int
+        docs,  # type: Iterable[Tuple[str, JSONType]]
+        *opts,  # type: MutationMultiOptions
+        **kwargs,  # type: Any
+    ) -> BulkMutationResult:
+        bulk_args = {
+            'max_in_flight': kwargs.pop('max_in_flight', 128),
+            'max_bytes': kwargs.pop('max_bytes', 0),
+        }
+        error_handler = kwargs.pop('error_handler', None)
+        if error_handler is not None:
+            bulk_args['error_sink'] = lambda k, e: error_handler(k, ErrorMapper.build_exception(e))
+        progress_handler = kwargs.pop('progress_handler', None)
+        if progress_handler is not None:
+            bulk_args['progress'] = lambda c: progress_handler(BulkMutationResult(c))
+
+        opts_type = kwargs.pop('opts_type', None)
+        final_args = get_valid_multi_args(opts_type, kwargs, *opts)
+        final_args.pop('per_key_options', None)
+        final_args.pop('return_exceptions', None)
+        transcoder = final_args.pop('transcoder', self.default_transcoder)
+
+        def op_args():
+            # lazily transcode so only the in-flight window is held in memory
+            for key, value in docs:
+                key_args = copy(final_args)
+                key_args['value'] = transcoder.encode_value(value)
+                yield key, key_args
+
+        res = kv_bulk_operation(
+            **self._get_connection_args(),
+            op_type=op_type,
+            docs=op_args(),
+            **bulk_args
+        )
+        return BulkMutationResult(res)
+
+    def upsert_bulk(
+        self,
+        docs,  # type: Iterable[Tuple[str, JSONType]]
+        *opts,  # type: UpsertMultiOptions
+        **kwargs,  # type: Any
+    ) -> BulkMutationResult:
+        """Upserts each (key, value/doc) pair yielded by the provided iterable, keeping a bounded window of
+        operations in flight.  Documents are pulled from the iterable only as the window has room, so
+        arbitrarily large imports run in constant memory.
+
+        .. note::
+            This method is part of a **volatile** API that is subject to change.
+
+        Args:
+            docs (Iterable[Tuple[str, JSONType]]): The (key, value/doc) pairs to upsert.
+            opts (:class:`~couchbase.options.UpsertMultiOptions`): Optional parameters for the operations.
+                *per_key_options* and *return_exceptions* are not used for bulk operations.
+            **kwargs (Dict[str, Any]): keyword arguments that can be used in place or to
+                override provided :class:`~couchbase.options.UpsertMultiOptions`.  Additionally:
+
+                * max_in_flight (int): The maximum number of outstanding operations. Defaults to 128.
+                * max_bytes (int): The maximum number of outstanding key and value bytes, 0 (the default)
+                  for no limit.
+
+                Both limits apply to the whole run, not to each node: a single slow node can take up the
+                window and hold back the operations for the other nodes.
+                * error_handler (Callable[[str, Exception], None]): Called for each key that failed. Failed keys
+                  do not stop the run.
+                * progress_handler (Callable[[:class:`~couchbase.result.BulkMutationResult`], None]): Called
+                  with the running counters each time completed operations are processed.
+
+        Returns:
+            :class:`~couchbase.result.BulkMutationResult`: The final counters of the run.
+
+        Examples:
+
+            Import documents from a generator::
+
+                failed = {}
+                res = collection.upsert_bulk(((f'doc{i}', {'id': i}) for i in range(1000000)),
+                                             max_in_flight=256,
+                                             error_handler=lambda k, e: failed.update({k: e}))
+                print(f'{res.succeeded} of {res.submitted} documents imported')
+
+        """
+        return self._bulk_mutation(operations.UPSERT.value, docs, *opts, opts_type=UpsertMultiOptions, **kwargs)
+
+    def insert_bulk(
+        self,
+        docs,  # type: Iterable[Tuple[str, JSONType]]
+        *opts,  # type: InsertMultiOptions
+        **kwargs,  # type: Any
+    ) -> BulkMutationResult:
+        """Inserts each (key, value/doc) pair yielded by the provided iterable, keeping a bounded window of
+        operations in flight.  See :meth:`.upsert_bulk` for the window and handler keyword arguments.
+
+        .. note::
+            This method is part of a **volatile** API that is subject to change.
+
+        Args:
+            docs (Iterable[Tuple[str, JSONType]]): The (key, value/doc) pairs to insert.
+            opts (:class:`~couchbase.options.InsertMultiOptions`): Optional parameters for the operations.
+            **kwargs (Dict[str, Any]): keyword arguments that can be used in place or to
+                override provided :class:`~couchbase.options.InsertMultiOptions`
+
+        Returns:
+            :class:`~couchbase.result.BulkMutationResult`: The final counters of the run.
+
+        """
+        return self._bulk_mutation(operations.INSERT.value, docs, *opts, opts_type=InsertMultiOptions, **kwargs)
+
     def _get_multi_op_args(
         self,
         keys,  # type: List[str]
@@ -1687,6 +1841,9 @@ class Collection(CollectionLogic):
                 op_args[key].update(per_key_args[key])
             else:
                 key_transcoders[key] = op_transcoder
+            if supports_native_decode(key_transcoders[key]):
+                op_args[key]['native_json'] = True
+            apply_miss_as_none(op_args[key])
 
         return_exceptions = final_args.pop('return_exceptions', True)
         return op_args, return_exceptions, key_transcoders
@@ -1772,15 +1929,62 @@ class Collection(CollectionLogic):
         for k, v in res.raw_result.items():
             if k == 'all_okay':
                 continue
-            if isinstance(v, CouchbaseBaseException):
+            if isinstance(v, (CouchbaseBaseException, miss_result)):
                 continue
-            value = v.raw_result.get('value', None)
-            flags = v.raw_result.get('flags', None)
-            tc = transcoders[k]
-            v.raw_result['value'] = decode_value(tc, value, flags)
+            decode_result_value(transcoders[k], v)
 
         return MultiGetResult(res, return_exceptions)
 
+    def get_multi_stream(
+        self,
+        keys,  # type: List[str]
+        *opts,  # type: GetMultiOptions
+        **kwargs,  # type: Any
+    ) -> Iterable[Tuple[str, Union[GetResult, CouchbaseBaseException]]]:
+        """For each key in the provided list, retrieve the document associated with the key.  Unlike
+        :meth:`.get_multi`, results are yielded as soon as each operation completes instead of once all of
+        the operations have completed.
+
+        .. note::
+            This method is part of a **volatile** API that is subject to change.
+
+        Args:
+            keys (List[str]): The keys to use for the multiple get operations.
+            opts (:class:`~couchbase.options.GetMultiOptions`): Optional parameters for this operation.
+            **kwargs (Dict[str, Any]): keyword arguments that can be used in place or to
+                override provided :class:`~couchbase.options.GetMultiOptions`
+
+        Returns:
+            Iterable[Tuple[str, :class:`~couchbase.result.GetResult`]]: (key, result) tuples in completion
+            order.  If an operation failed, the exception is yielded in place of the result.
+
+        Raises:
+            :class:`~couchbase.exceptions.UnAmbiguousTimeoutException`: If no operation completes within the
+                operation timeout.
+
+        Examples:
+
+            Simple get-multi-stream operation::
+
+                collection = bucket.default_collection()
+                keys = ['doc1', 'doc2', 'doc3']
+                for k, v in collection.get_multi_stream(keys):
+                    print(f'Doc {k} has value: {v.content_as[dict]}')
+
+        """
+        op_args, _, transcoders = self._get_multi_op_args(keys,
+                                                          *opts,
+                                                          opts_type=GetMultiOptions,
+                                                          **kwargs)
+        op_type = operations.GET.value
+        res = kv_multi_operation(
+            **self._get_connection_args(),
+            op_type=op_type,
+            op_args=op_args,
+            stream=True
+        )
+        return decode_multi_stream(res, GetResult, transcoders)
+
     def get_any_replica_multi(
         self,
         keys,  # type: List[str]
@@ -1873,10 +2077,7 @@ class Collection(CollectionLogic):
                 continue
             if isinstance(v, CouchbaseBaseException):
                 continue
-            value = v.raw_result.get('value', None)
-            flags = v.raw_result.get('flags', None)
-            tc = transcoders[k]
-            v.raw_result['value'] = decode_value(tc, value, flags)
+            decode_result_value(transcoders[k], v)
 
         return MultiGetReplicaResult(res, return_exceptions)
 
@@ -2033,10 +2234,7 @@ class Collection(CollectionLogic):
                 continue
             if isinstance(v, CouchbaseBaseException):
                 continue
-            value = v.raw_result.get('value', None)
-            flags = v.raw_result.get('flags', None)
-            tc = transcoders[k]
-            v.raw_result['value'] = decode_value(tc, value, flags)
+            decode_result_value(transcoders[k], v)
 
         return MultiGetResult(res, return_exceptions)
 
@@ -2153,6 +2351,42 @@ class Collection(CollectionLogic):
         )
         return MultiMutationResult(res, return_exceptions)
 
+    def upsert_multi_stream(
+        self,
+        keys_and_docs,  # type: Dict[str, JSONType]
+        *opts,  # type: UpsertMultiOptions
+        **kwargs,  # type: Any
+    ) -> Iterable[Tuple[str, Union[MutationResult, CouchbaseBaseException]]]:
+        """For each key, value pair in the provided dict, upserts a document to the collection.  Unlike
+        :meth:`.upsert_multi`, results are yielded as soon as each operation completes.
+
+        .. note::
+            This method is part of a **volatile** API that is subject to change.
+
+        Args:
+            keys_and_docs (Dict[str, JSONType]): The keys and values/docs to use for the multiple upsert operations.
+            opts (:class:`~couchbase.options.UpsertMultiOptions`): Optional parameters for this operation.
+            **kwargs (Dict[str, Any]): keyword arguments that can be used in place or to
+                override provided :class:`~couchbase.options.UpsertMultiOptions`
+
+        Returns:
+            Iterable[Tuple[str, :class:`~couchbase.result.MutationResult`]]: (key, result) tuples in completion
+            order.  If an operation failed, the exception is yielded in place of the result.
+
+        """
+        op_args, _ = self._get_multi_mutation_transcoded_op_args(keys_and_docs,
+                                                                 *opts,
+                                                                 opts_type=UpsertMultiOptions,
+                                                                 **kwargs)
+        op_type = operations.UPSERT.value
+        res = kv_multi_operation(
+            **self._get_connection_args(),
+            op_type=op_type,
+            op_args=op_args,
+            stream=True
+        )
+        return decode_multi_stream(res, MutationResult)
+
     def replace_multi(
         self,
         keys_and_docs,  # type: Dict[str, JSONType]
@@ -2354,6 +2588,171 @@ class Collection(CollectionLogic):
 
         return output
 
+    def _get_multi_subdoc_op_args(
+        self,
+        keys_and_specs,  # type: Dict[str, Iterable[Spec]]
+        *opts,  # type: Union[LookupInMultiOptions, MutateInMultiOptions]
+        **kwargs,  # type: Any
+    ) -> Tuple[Dict[str, Any], bool, Dict[str, Transcoder]]:
+        if not isinstance(keys_and_specs, dict):
+            raise InvalidArgumentException(message='Expected keys_and_specs to be a dict.')
+
+        opts_type = kwargs.pop('opts_type', None)
+        if not opts_type:
+            raise InvalidArgumentException(message='Expected options type is missing.')
+
+        final_args = get_valid_multi_args(opts_type, kwargs, *opts)
+        op_transcoder = final_args.pop('transcoder', self.default_transcoder)
+        per_key_args = final_args.pop('per_key_options', None)
+        op_args = {}
+        key_transcoders = {}
+        # the same spec list is commonly shared by every key, encode (mutate_in) each distinct list only once
+        # and hand the same object to every key so the spec is also only parsed once by the core
+        encoded_specs = {}
+        for key, spec in keys_and_specs.items():
+            op_args[key] = copy(final_args)
+            key_transcoder = op_transcoder
+            # per key args override global args
+            if per_key_args and key in per_key_args:
+                key_opts = dict(per_key_args[key])
+                key_transcoder = key_opts.pop('transcoder', op_transcoder)
+                op_args[key].update(key_opts)
+            key_transcoders[key] = key_transcoder
+            if opts_type is MutateInMultiOptions:
+                spec_key = (id(spec), id(key_transcoder))
+                if spec_key not in encoded_specs:
+                    encoded_specs[spec_key] = self._encode_mutate_in_spec(spec, key_transcoder)
+                op_args[key]['spec'] = encoded_specs[spec_key]
+            else:
+                if isinstance(spec, CompiledSpec):
+                    op_args[key]['spec'] = spec._spec
+                else:
+                    op_args[key]['spec'] = spec if isinstance(spec, (list, tuple)) else list(spec)
+
+        return_exceptions = final_args.pop('return_exceptions', True)
+        return op_args, return_exceptions, key_transcoders
+
+    def lookup_in_multi(
+        self,
+        keys_and_specs,  # type: Dict[str, Iterable[Spec]]
+        *opts,  # type: LookupInMultiOptions
+        **kwargs,  # type: Any
+    ) -> MultiLookupInResult:
+        """For each key in the provided dict, performs a lookup-in operation against the document using the
+        key's provided specs.
+
+        .. note::
+            This method is part of an **uncommitted** API that is unlikely to change,
+            but may still change as final consensus on its behavior has not yet been reached.
+
+        Args:
+            keys_and_specs (Dict[str, Iterable[:class:`~couchbase.subdocument.Spec`]]): The keys and specs to
+                use for the multiple lookup-in operations.
+            opts (:class:`~couchbase.options.LookupInMultiOptions`): Optional parameters for this operation.
+            **kwargs (Dict[str, Any]): keyword arguments that can be used in place or to
+                override provided :class:`~couchbase.options.LookupInMultiOptions`
+
+        Returns:
+            :class:`~couchbase.result.MultiLookupInResult`: An instance of
+            :class:`~couchbase.result.MultiLookupInResult`.
+
+        Raises:
+            :class:`~couchbase.exceptions.DocumentNotFoundException`: If the key provided does not exist on the
+                server and the return_exceptions options is False.  Otherwise the exception is returned as a
+                match to the key, but is not raised.
+
+        Examples:
+
+            Simple lookup-in-multi operation, sharing a single spec across keys::
+
+                import couchbase.subdocument as SD
+
+                # ... other code ...
+
+                collection = bucket.default_collection()
+                spec = (SD.get('geo.lat'),)
+                res = collection.lookup_in_multi({'hotel_10025': spec, 'hotel_10026': spec})
+                for k, v in res.results.items():
+                    print(f'Doc {k} has latitude: {v.content_as[float](0)}')
+
+        """
+        op_args, return_exceptions, transcoders = self._get_multi_subdoc_op_args(keys_and_specs,
+                                                                                 *opts,
+                                                                                 opts_type=LookupInMultiOptions,
+                                                                                 **kwargs)
+        op_type = operations.LOOKUP_IN.value
+        res = subdoc_multi_operation(
+            **self._get_connection_args(),
+            op_type=op_type,
+            op_args=op_args
+        )
+        for k, v in res.raw_result.items():
+            if k == 'all_okay':
+                continue
+            if isinstance(v, CouchbaseBaseException):
+                continue
+            value = v.raw_result.get('value', None)
+            flags = v.raw_result.get('flags', None)
+            v.raw_result['value'] = decode_value(transcoders[k], value, flags, is_subdoc=True)
+
+        return MultiLookupInResult(res, return_exceptions)
+
+    def mutate_in_multi(
+        self,
+        keys_and_specs,  # type: Dict[str, Iterable[Spec]]
+        *opts,  # type: MutateInMultiOptions
+        **kwargs,  # type: Any
+    ) -> MultiMutateInResult:
+        """For each key in the provided dict, performs a mutate-in operation against the document using the
+        key's provided specs.
+
+        .. note::
+            This method is part of an **uncommitted** API that is unlikely to change,
+            but may still change as final consensus on its behavior has not yet been reached.
+
+        Args:
+            keys_and_specs (Dict[str, Iterable[:class:`~couchbase.subdocument.Spec`]]): The keys and specs to
+                use for the multiple mutate-in operations.
+            opts (:class:`~couchbase.options.MutateInMultiOptions`): Optional parameters for this operation.
+            **kwargs (Dict[str, Any]): keyword arguments that can be used in place or to
+                override provided :class:`~couchbase.options.MutateInMultiOptions`
+
+        Returns:
+            :class:`~couchbase.result.MultiMutateInResult`: An instance of
+            :class:`~couchbase.result.MultiMutateInResult`.
+
+        Raises:
+            :class:`~couchbase.exceptions.DocumentNotFoundException`: If the key provided does not exist on the
+                server and the return_exceptions options is False.  Otherwise the exception is returned as a
+                match to the key, but is not raised.
+
+        Examples:
+
+            Simple mutate-in-multi operation, sharing a single spec across keys::
+
+                import couchbase.subdocument as SD
+
+                # ... other code ...
+
+                collection = bucket.default_collection()
+                spec = (SD.upsert('city', 'New City'),)
+                res = collection.mutate_in_multi({'hotel_10025': spec, 'hotel_10026': spec})
+                for k, v in res.results.items():
+                    print(f'Doc {k} has cas: {v.cas}')
+
+        """
+        op_args, return_exceptions, _ = self._get_multi_subdoc_op_args(keys_and_specs,
+                                                                       *opts,
+                                                                       opts_type=MutateInMultiOptions,
+                                                                       **kwargs)
+        op_type = operations.MUTATE_IN.value
+        res = subdoc_multi_operation(
+            **self._get_connection_args(),
+            op_type=op_type,
+            op_args=op_args
+        )
+        return MultiMutateInResult(res, return_exceptions)
+
     def _get_multi_counter_op_args(
         self,
         keys,  # type: List[str]
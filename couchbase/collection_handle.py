@@ -0,0 +1,192 @@
+#  Copyright 2016-2022. Couchbase, Inc.
+#  All Rights Reserved.
+#
+#  Licensed under the Apache License, Version 2.0 (the "License")
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+from __future__ import annotations
+
+from datetime import timedelta
+from typing import (TYPE_CHECKING,
+                    Any,
+                    Optional)
+
+from couchbase._utils import timedelta_as_microseconds, timedelta_as_timestamp
+from couchbase.exceptions import ErrorMapper
+from couchbase.exceptions import exception as BaseCouchbaseException
+from couchbase.logic.wrappers import decode_result_value, supports_native_decode
+from couchbase.pycbc_core import kv_handle
+from couchbase.result import (ExistsResult,
+                              GetResult,
+                              MutationResult)
+
+if TYPE_CHECKING:
+    from couchbase.collection import Collection
+    from couchbase.transcoder import Transcoder
+
+
+class CollectionHandle:
+    """Key-value operations bound to a :class:`~couchbase.collection.Collection`.
+
+    The connection, keyspace and transcoder are resolved once when the handle is created and each call hands its
+    arguments positionally to the C++ client, skipping the options parsing the :class:`~couchbase.collection.Collection`
+    methods do.  Only a timeout, an expiry and a CAS are supported, use the :class:`~couchbase.collection.Collection`
+    methods for anything else (durability, projections, ...).
+
+    A handle is created with :meth:`~couchbase.collection.Collection.handle` and can be reused across calls and
+    threads.
+    """
+
+    def __init__(self,
+                 collection,  # type: Collection
+                 transcoder=None,  # type: Optional[Transcoder]
+                 ):
+        self._handle = kv_handle(**collection._get_connection_args())
+        self._transcoder = transcoder or collection.default_transcoder
+        self._native_json = supports_native_decode(self._transcoder)
+
+    @property
+    def transcoder(self) -> Transcoder:
+        """
+            :class:`~couchbase.transcoder.Transcoder`: The transcoder used to encode and decode documents.
+        """
+        return self._transcoder
+
+    def get(self,
+            key,  # type: str
+            timeout=None,  # type: Optional[timedelta]
+            ) -> GetResult:
+        """Retrieves the value of a document, see :meth:`~couchbase.collection.Collection.get`.
+
+        Args:
+            key (str): The key for the document to retrieve.
+            timeout (timedelta, optional): The timeout for this operation.
+
+        Raises:
+            :class:`~couchbase.exceptions.DocumentNotFoundException`: If the key provided does not exist.
+        """
+        ret = self._handle.get(key, timedelta_as_microseconds(timeout), self._native_json)
+        if isinstance(ret, BaseCouchbaseException):
+            raise ErrorMapper.build_exception(ret)
+        decode_result_value(self._transcoder, ret)
+        return GetResult(ret)
+
+    def exists(self,
+               key,  # type: str
+               timeout=None,  # type: Optional[timedelta]
+               ) -> ExistsResult:
+        """Checks whether a document exists, see :meth:`~couchbase.collection.Collection.exists`.
+
+        Args:
+            key (str): The key for the document to check.
+            timeout (timedelta, optional): The timeout for this operation.
+        """
+        ret = self._handle.exists(key, timedelta_as_microseconds(timeout))
+        if isinstance(ret, BaseCouchbaseException):
+            raise ErrorMapper.build_exception(ret)
+        return ExistsResult(ret)
+
+    def upsert(self,
+               key,  # type: str
+               value,  # type: Any
+               timeout=None,  # type: Optional[timedelta]
+               expiry=None,  # type: Optional[timedelta]
+               ) -> MutationResult:
+        """Upserts a document, see :meth:`~couchbase.collection.Collection.upsert`.
+
+        Args:
+            key (str): The key for the document to upsert.
+            value (Any): The document, encoded w/ the handle's transcoder.
+            timeout (timedelta, optional): The timeout for this operation.
+            expiry (timedelta, optional): The expiry of the document.
+        """
+        ret = self._handle.upsert(key,
+                                  self._transcoder.encode_value(value),
+                                  timedelta_as_microseconds(timeout),
+                                  timedelta_as_timestamp(expiry) if expiry else 0)
+        if isinstance(ret, BaseCouchbaseException):
+            raise ErrorMapper.build_exception(ret)
+        return MutationResult(ret)
+
+    def insert(self,
+               key,  # type: str
+               value,  # type: Any
+               timeout=None,  # type: Optional[timedelta]
+               expiry=None,  # type: Optional[timedelta]
+               ) -> MutationResult:
+        """Inserts a new document, see :meth:`~couchbase.collection.Collection.insert`.
+
+        Args:
+            key (str): The key for the document to insert.
+            value (Any): The document, encoded w/ the handle's transcoder.
+            timeout (timedelta, optional): The timeout for this operation.
+            expiry (timedelta, optional): The expiry of the document.
+
+        Raises:
+            :class:`~couchbase.exceptions.DocumentExistsException`: If the document already exists.
+        """
+        ret = self._handle.insert(key,
+                                  self._transcoder.encode_value(value),
+                                  timedelta_as_microseconds(timeout),
+                                  timedelta_as_timestamp(expiry) if expiry else 0)
+        if isinstance(ret, BaseCouchbaseException):
+            raise ErrorMapper.build_exception(ret)
+        return MutationResult(ret)
+
+    def replace(self,
+                key,  # type: str
+                value,  # type: Any
+                timeout=None,  # type: Optional[timedelta]
+                expiry=None,  # type: Optional[timedelta]
+                cas=0,  # type: int
+                ) -> MutationResult:
+        """Replaces an existing document, see :meth:`~couchbase.collection.Collection.replace`.
+
+        Args:
+            key (str): The key for the document to replace.
+            value (Any): The document, encoded w/ the handle's transcoder.
+            timeout (timedelta, optional): The timeout for this operation.
+            expiry (timedelta, optional): The expiry of the document.
+            cas (int, optional): Only replace the document if its CAS matches.
+
+        Raises:
+            :class:`~couchbase.exceptions.DocumentNotFoundException`: If the key provided does not exist.
+            :class:`~couchbase.exceptions.CasMismatchException`: If the CAS does not match.
+        """
+        ret = self._handle.replace(key,
+                                   self._transcoder.encode_value(value),
+                                   timedelta_as_microseconds(timeout),
+                                   timedelta_as_timestamp(expiry) if expiry else 0,
+                                   cas)
+        if isinstance(ret, BaseCouchbaseException):
+            raise ErrorMapper.build_exception(ret)
+        return MutationResult(ret)
+
+    def remove(self,
+               key,  # type: str
+               timeout=None,  # type: Optional[timedelta]
+               cas=0,  # type: int
+               ) -> MutationResult:
+        """Removes a document, see :meth:`~couchbase.collection.Collection.remove`.
+
+        Args:
+            key (str): The key for the document to remove.
+            timeout (timedelta, optional): The timeout for this operation.
+            cas (int, optional): Only remove the document if its CAS matches.
+
+        Raises:
+            :class:`~couchbase.exceptions.DocumentNotFoundException`: If the key provided does not exist.
+        """
+        ret = self._handle.remove(key, timedelta_as_microseconds(timeout), cas)
+        if isinstance(ret, BaseCouchbaseException):
+            raise ErrorMapper.build_exception(ret)
+        return MutationResult(ret)
@@ -19,4 +19,7 @@ from couchbase.pycbc_core import (FMT_BYTES,
                                   FMT_JSON,
                                   FMT_LEGACY_MASK,
                                   FMT_PICKLE,
-                                  FMT_UTF8)
+                                  FMT_UTF8,
+                                  READ_MISS_CAS_MISMATCH,
+                                  READ_MISS_LOCKED,
+                                  READ_MISS_NOT_FOUND)
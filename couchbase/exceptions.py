@@ -397,7 +397,12 @@ class CouchbaseException(Exception):
         Returns:
             Optional[Exception]: Exception's inner cause, if it exists.
         """
-        return self._exc_info.get('inner_cause', None)
+        return self._get_exc_info().get('inner_cause', None)
+
+    def _get_exc_info(self) -> Dict[str, Any]:
+        if self._exc_info is None and self._base:
+            self._exc_info = self._base.error_info()
+        return self._exc_info or dict()
 
     @classmethod
     def pycbc_create_exception(cls, base=None, message=None):
@@ -418,12 +423,16 @@ class CouchbaseException(Exception):
         else:
             if not is_null_or_empty(self._message):
                 details.append(f'message={self._message}')
+        if self._context is None and self._base and self._base.error_context_type() is not None:
+            # the context has not been built yet
+            self._context = self.error_context
         if self._context:
             details.append(f'context={self._context}')
-        if self._exc_info and 'cinfo' in self._exc_info:
-            details.append('C Source={0}:{1}'.format(*self._exc_info['cinfo']))
-        if self._exc_info and 'inner_cause' in self._exc_info:
-            details.append('Inner cause={0}'.format(self._exc_info['inner_cause']))
+        exc_info = self._get_exc_info()
+        if 'cinfo' in exc_info:
+            details.append('C Source={0}:{1}'.format(*exc_info['cinfo']))
+        if 'inner_cause' in exc_info:
+            details.append('Inner cause={0}'.format(exc_info['inner_cause']))
         return "<{}>".format(", ".join(details))
 
     def __str__(self):
@@ -1867,6 +1876,13 @@ class ErrorMapper:
                         ) -> CouchbaseException:
         exc_class = None
         err_ctx = None
+        if (base_exc.error_context_type() in ('KeyValueErrorContext', 'SubdocumentErrorContext')
+                and not base_exc.has_retry_reasons()):
+            # KV contexts are only mapped on their retry reasons, w/o any there is no need to build the
+            # context (or the exc_info) up front, the exception builds them on first access
+            exc_class = PYCBC_ERROR_MAP.get(base_exc.err(), CouchbaseException)
+            return exc_class(base=base_exc)
+
         ctx = base_exc.error_context()
         if ctx is None:
             exc_class = PYCBC_ERROR_MAP.get(base_exc.err(), CouchbaseException)
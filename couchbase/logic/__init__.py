@@ -14,5 +14,9 @@
 #  limitations under the License.
 
 from .wrappers import BlockingWrapper  # noqa: F401
+from .wrappers import apply_miss_as_none  # noqa: F401
+from .wrappers import decode_multi_stream  # noqa: F401
 from .wrappers import decode_replicas  # noqa: F401
+from .wrappers import decode_result_value  # noqa: F401
 from .wrappers import decode_value  # noqa: F401
+from .wrappers import supports_native_decode  # noqa: F401
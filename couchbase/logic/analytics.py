@@ -424,6 +424,14 @@ class AnalyticsRequestLogic:
         # @TODO:  raise if query isn't complete?
         return self._metadata
 
+    def cancel(self) -> None:
+        # once cancelled there are no more rows, nor any metadata
+        if self.done_streaming:
+            return
+        self._done_streaming = True
+        if self._streaming_result is not None:
+            self._streaming_result.cancel()
+
     def _set_metadata(self, analytics_response):
         if isinstance(analytics_response, CouchbaseBaseException):
             raise ErrorMapper.build_exception(analytics_response)
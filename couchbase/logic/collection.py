@@ -12,12 +12,12 @@
 #  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 #  See the License for the specific language governing permissions and
 #  limitations under the License.
-import json
 from datetime import timedelta
 from typing import (TYPE_CHECKING,
                     Any,
                     Dict,
                     Iterable,
+                    List,
                     Optional,
                     Union)
 
@@ -26,9 +26,11 @@ from couchbase.exceptions import InvalidArgumentException
 from couchbase.logic.options import DeltaValueBase, SignedInt64Base
 from couchbase.options import forward_args
 from couchbase.pycbc_core import (binary_operation,
+                                  configure_read_cache,
                                   kv_operation,
                                   operations,
-                                  subdoc_operation)
+                                  subdoc_operation,
+                                  subdoc_spec)
 from couchbase.result import (CounterResult,
                               ExistsResult,
                               GetReplicaResult,
@@ -36,9 +38,11 @@ from couchbase.result import (CounterResult,
                               LookupInResult,
                               MutateInResult,
                               MutationResult)
-from couchbase.subdocument import (Spec,
+from couchbase.subdocument import (CompiledSpec,
+                                   Spec,
                                    StoreSemantics,
-                                   SubDocOp)
+                                   SubDocOp,
+                                   encode_spec_value)
 from couchbase.transcoder import Transcoder
 
 if TYPE_CHECKING:
@@ -92,6 +96,36 @@ class CollectionLogic:
         """
         self._connection = self._scope.connection
 
+    def enable_read_cache(self,
+                          max_bytes,  # type: int
+                          ttl,  # type: timedelta
+                          revalidate=False,  # type: Optional[bool]
+                          ) -> None:
+        """Serve :meth:`get` calls of this collection from an in-process document cache.
+
+        Documents returned by the server are kept (LRU, sharded by key) until the cache holds ``max_bytes`` or
+        their ``ttl`` passed.  Mutations made through this SDK instance, including touch, get-and-touch, get-and-lock
+        and unlock, drop the document from the cache, writes from other clients are only observed once the entry
+        expired.  Only plain :meth:`get` calls (no projections or ``with_expiry``) are cached.  Counters are
+        reported under ``read_caches`` by the connection info.
+
+        Args:
+            max_bytes (int): Upper bound of the memory used by cached documents (including the parsed form kept
+                for JSON documents), 0 disables the cache.  Any document that fits in ``max_bytes`` can be cached.
+            ttl (timedelta): How long a cached document is served without contacting the server.
+            revalidate (bool, optional): If set, an expired document is validated w/ an exists probe and served
+                again if its CAS did not change, instead of being fetched again.
+        """
+        configure_read_cache(**self._get_connection_args(),
+                             max_bytes=max_bytes,
+                             ttl=int(ttl.total_seconds() * 1e3),
+                             revalidate=revalidate)
+
+    def disable_read_cache(self) -> None:
+        """Drop the document cache enabled w/ :meth:`enable_read_cache`.
+        """
+        configure_read_cache(**self._get_connection_args(), max_bytes=0)
+
     def _get_connection_args(self) -> Dict[str, Any]:
         return {
             "conn": self._connection,
@@ -336,11 +370,31 @@ class CollectionLogic:
         return subdoc_operation(
             **self._get_connection_args(),
             key=key,
-            spec=spec,
+            spec=spec._spec if isinstance(spec, CompiledSpec) else spec,
             op_type=op_type,
             op_args=final_args
         )
 
+    def _encode_mutate_in_spec(self,
+                               spec,  # type: Union[Iterable[Spec], CompiledSpec]
+                               transcoder,  # type: Transcoder
+                               ) -> Union[List[Spec], subdoc_spec]:
+        """**INTERNAL**
+        Encodes the values of the mutate_in spec.
+        """
+        if isinstance(spec, CompiledSpec):
+            # values were encoded when the spec was compiled (or bound)
+            return spec._spec
+
+        final_spec = []
+        for s in spec:
+            if len(s) == 6:
+                final_spec.append(tuple(s[:5]) + (encode_spec_value(s[0], s[5], transcoder),))
+            else:
+                final_spec.append(s)
+
+        return final_spec
+
     def mutate_in(   # noqa: C901
         self,
         key,  # type: str
@@ -355,7 +409,7 @@ class CollectionLogic:
         expiry = final_args.get('expiry', None)
         preserve_expiry = final_args.get('preserve_expiry', False)
 
-        spec_ops = [s[0] for s in spec]
+        spec_ops = spec.ops if isinstance(spec, CompiledSpec) else [s[0] for s in spec]
         if SubDocOp.DICT_ADD in spec_ops and preserve_expiry is True:
             raise InvalidArgumentException(
                 'The preserve_expiry option cannot be set for mutate_in with insert operations.')
@@ -389,31 +443,11 @@ class CollectionLogic:
         if replace_semantics is not None:
             final_args["store_semantics"] = StoreSemantics.REPLACE
 
-        final_spec = []
-        allowed_multi_ops = [SubDocOp.ARRAY_PUSH_FIRST,
-                             SubDocOp.ARRAY_PUSH_LAST,
-                             SubDocOp.ARRAY_ADD_UNIQUE,
-                             SubDocOp.ARRAY_INSERT]
-
-        for s in spec:
-            if len(s) == 6:
-                tmp = list(s[:5])
-                if s[0] in allowed_multi_ops:
-                    new_value = json.dumps(s[5], ensure_ascii=False)
-                    # this is an array, need to remove brackets
-                    tmp.append(new_value[1:len(new_value)-1].encode('utf-8'))
-                else:
-                    # no need to propagate the flags
-                    tmp.append(transcoder.encode_value(s[5])[0])
-                final_spec.append(tuple(tmp))
-            else:
-                final_spec.append(s)
-
         op_type = operations.MUTATE_IN.value
         return subdoc_operation(
             **self._get_connection_args(),
             key=key,
-            spec=final_spec,
+            spec=self._encode_mutate_in_spec(spec, transcoder),
             op_type=op_type,
             op_args=final_args
         )
@@ -496,12 +530,11 @@ class CollectionLogic:
         final_args = self._get_mutation_options(*opts, **kwargs)
         if isinstance(value, str):
             value = value.encode("utf-8")
-        elif isinstance(value, bytearray):
-            value = bytes(value)
 
-        if not isinstance(value, bytes):
+        # buffers are read in place by pycbc_core, no need to copy them into bytes
+        if not isinstance(value, (bytes, bytearray, memoryview)):
             raise ValueError(
-                "The value provided must of type str, bytes or bytearray.")
+                "The value provided must of type str, bytes, bytearray or memoryview.")
 
         op_type = operations.APPEND.value
         return binary_operation(**self._get_connection_args(),
@@ -520,12 +553,11 @@ class CollectionLogic:
         final_args = self._get_mutation_options(*opts, **kwargs)
         if isinstance(value, str):
             value = value.encode("utf-8")
-        elif isinstance(value, bytearray):
-            value = bytes(value)
 
-        if not isinstance(value, bytes):
+        # buffers are read in place by pycbc_core, no need to copy them into bytes
+        if not isinstance(value, (bytes, bytearray, memoryview)):
             raise ValueError(
-                "The value provided must of type str, bytes or bytearray.")
+                "The value provided must of type str, bytes, bytearray or memoryview.")
 
         op_type = operations.PREPEND.value
         return binary_operation(**self._get_connection_args(),
@@ -760,6 +760,14 @@ class QueryRequestLogic:
         # @TODO:  raise if query isn't complete?
         return self._metadata
 
+    def cancel(self) -> None:
+        # once cancelled there are no more rows, nor any metadata
+        if self.done_streaming:
+            return
+        self._done_streaming = True
+        if self._streaming_result is not None:
+            self._streaming_result.cancel()
+
     def _set_metadata(self, query_response):
         if isinstance(query_response, CouchbaseBaseException):
             raise ErrorMapper.build_exception(query_response)
@@ -119,7 +119,10 @@ VALID_MULTI_OPTS = {
     'delta': lambda x: x,
     'initial': lambda x: x,
     'per_key_options': lambda x: x,
-    'return_exceptions': validate_bool
+    'return_exceptions': validate_bool,
+    'miss_as_none': validate_bool,
+    'access_deleted': validate_bool,
+    'store_semantics': lambda x: x
 }
 
 
@@ -542,6 +545,12 @@ class ClusterOptionsBase(dict):
         "cert_path": {"cert_path": validate_str},
         "logging_meter_emit_interval": {"emit_interval": timedelta_as_microseconds},
         "num_io_threads": {"num_io_threads": validate_int},
+        "io_sharding": {"io_sharding": validate_bool},
+        "coalesce_reads": {"coalesce_reads": validate_bool},
+        "hedge_reads_after": {"hedge_reads_after": timedelta_as_microseconds},
+        "stream_high_water_rows": {"stream_high_water_rows": validate_int},
+        "stream_high_water_bytes": {"stream_high_water_bytes": validate_int},
+        "prepared_statement_cache_size": {"prepared_statement_cache_size": validate_int},
         "transaction_config": {"transaction_config": lambda x: x},
         "tracer": {"tracer": lambda x: x},
         "meter": {"meter": lambda x: x},
@@ -586,6 +595,12 @@ class ClusterOptionsBase(dict):
         meter=None,  # type: Optional[CouchbaseMeter]
         dns_nameserver=None,  # type: Optional[str]
         dns_port=None,  # type: Optional[int]
+        io_sharding=None,  # type: Optional[bool]
+        coalesce_reads=None,  # type: Optional[bool]
+        hedge_reads_after=None,  # type: Optional[timedelta]
+        stream_high_water_rows=None,  # type: Optional[int]
+        stream_high_water_bytes=None,  # type: Optional[int]
+        prepared_statement_cache_size=None,  # type: Optional[int]
     ):
         """ClusterOptions instance."""
 
@@ -825,7 +840,8 @@ class GetOptionsBase(OptionsTimeoutBase):
         timeout=None,  # type: Optional[timedelta]
         with_expiry=None,  # type: Optional[bool]
         project=None,  # type: Optional[Iterable[str]]
-        transcoder=None  # type: Optional[Transcoder]
+        transcoder=None,  # type: Optional[Transcoder]
+        miss_as_none=None  # type: Optional[bool]
     ):
         pass
 
@@ -837,6 +853,10 @@ class GetOptionsBase(OptionsTimeoutBase):
     def with_expiry(self) -> bool:
         return self.get("with_expiry", False)
 
+    @property
+    def miss_as_none(self) -> bool:
+        return self.get("miss_as_none", False)
+
     @property
     def project(self) -> Iterable[str]:
         return self.get("project", [])
@@ -1319,6 +1319,14 @@ class SearchRequestLogic:
         # @TODO:  raise if query isn't complete?
         return self._metadata
 
+    def cancel(self) -> None:
+        # once cancelled there are no more rows, nor any metadata
+        if self.done_streaming:
+            return
+        self._done_streaming = True
+        if self._streaming_result is not None:
+            self._streaming_result.cancel()
+
     def result_rows(self):
         return self._result_rows
 
@@ -18,7 +18,7 @@ from __future__ import annotations
 from copy import copy
 from functools import wraps
 
-from couchbase.constants import FMT_JSON
+from couchbase.constants import FMT_JSON, READ_MISS_NOT_FOUND
 from couchbase.exceptions import (PYCBC_ERROR_MAP,
                                   CouchbaseException,
                                   DocumentExistsException,
@@ -31,6 +31,7 @@ from couchbase.exceptions import (PYCBC_ERROR_MAP,
                                   UnAmbiguousTimeoutException)
 from couchbase.exceptions import exception as BaseCouchbaseException
 from couchbase.exceptions import exception as CouchbaseBaseException
+from couchbase.pycbc_core import miss_result
 
 
 def decode_value(transcoder, value, flags, is_subdoc=False):
@@ -55,6 +56,40 @@ def decode_value(transcoder, value, flags, is_subdoc=False):
     return final_value
 
 
+def supports_native_decode(transcoder):
+    """Whether the transcoder lets the C++ core decode JSON documents (off the GIL) on its behalf."""
+    return getattr(transcoder, 'native_json_decode', False) is True
+
+
+def supports_zero_copy_decode(transcoder):
+    """Whether the transcoder accepts a read-only memoryview over the document instead of bytes."""
+    return getattr(transcoder, 'zero_copy_decode', False) is True
+
+
+def apply_miss_as_none(op_args):
+    """Translates the miss_as_none option into the read_miss flags understood by pycbc_core."""
+    if op_args.pop('miss_as_none', False) is True:
+        op_args['miss_errors'] = op_args.get('miss_errors', 0) | READ_MISS_NOT_FOUND
+
+
+def decode_result_value(transcoder, result):
+    """Decodes the result's value in place, unless the native JSON decoder already did.
+
+    Goes through result.get()/result.set() so fields that are not needed are never created.
+    """
+    flags = result.get('flags', None)
+    if supports_zero_copy_decode(transcoder):
+        # has to be requested before value/value_decoded, either would copy the document into bytes
+        value = result.get('value_view', None)
+        if value is not None:
+            result.set('value', decode_value(transcoder, value, flags))
+            return
+    if result.get('value_decoded', False):
+        return
+    value = result.get('value', None)
+    result.set('value', decode_value(transcoder, value, flags))
+
+
 def decode_replicas(transcoder, result, return_cls):
     while True:
         try:
@@ -75,6 +110,35 @@ def decode_replicas(transcoder, result, return_cls):
             yield return_cls(res)
 
 
+def decode_multi_stream(result, return_cls, transcoders=None):
+    """Yields (key, result) tuples from a streaming multi op in the order the operations complete.
+
+    Per-key failures are yielded as exceptions (matched to the key) rather than raised.
+    """
+    while True:
+        try:
+            res = next(result)
+        except StopIteration:
+            # this is a timeout from pulling a result from the queue, kill the generator
+            raise UnAmbiguousTimeoutException('Timeout reached waiting for result in queue.') from None
+        else:
+            # the stream is terminated w/ None once every key has completed
+            if res is None:
+                return
+
+            key, val = res
+            if isinstance(val, CouchbaseBaseException):
+                yield key, ErrorMapper.build_exception(val)
+                continue
+            if isinstance(val, miss_result):
+                yield key, None
+                continue
+
+            if transcoders is not None:
+                decode_result_value(transcoders[key], val)
+            yield key, return_cls(val)
+
+
 class BlockingWrapper:
     @classmethod  # noqa: C901
     def block(cls, return_cls):  # noqa: C901
@@ -114,19 +178,27 @@ class BlockingWrapper:
             def wrapped_fn(self, *args, **kwargs):
                 try:
                     transcoder = kwargs.pop('transcoder')
+                    is_subdoc = fn.__name__ == '_lookup_in_internal'
+                    is_all_replicas = fn.__name__ == '_get_all_replicas_internal'
+                    if not (is_subdoc or is_all_replicas) and supports_native_decode(transcoder):
+                        kwargs['native_json'] = True
                     ret = fn(self, *args, **kwargs)
                     if isinstance(ret, BaseCouchbaseException):
                         raise ErrorMapper.build_exception(ret)
+                    # miss_as_none, the document was not found
+                    if isinstance(ret, miss_result):
+                        return None
 
                     # special case for get_all_replicas
-                    if fn.__name__ == '_get_all_replicas_internal':
+                    if is_all_replicas:
                         return decode_replicas(transcoder, ret, return_cls)
 
-                    value = ret.raw_result.get('value', None)
-                    flags = ret.raw_result.get('flags', None)
-
-                    is_suboc = fn.__name__ == '_lookup_in_internal'
-                    ret.raw_result['value'] = decode_value(transcoder, value, flags, is_subdoc=is_suboc)
+                    if is_subdoc:
+                        value = ret.raw_result.get('value', None)
+                        flags = ret.raw_result.get('flags', None)
+                        ret.raw_result['value'] = decode_value(transcoder, value, flags, is_subdoc=True)
+                    else:
+                        decode_result_value(transcoder, ret)
                     if return_cls is None:
                         return None
                     elif return_cls is True:
@@ -13,11 +13,19 @@
 #  See the License for the specific language governing permissions and
 #  limitations under the License.
 
+from collections import deque
+from datetime import timedelta
+from typing import (Any,
+                    List,
+                    Optional)
+
+from couchbase._utils import timedelta_as_microseconds
 from couchbase.exceptions import (PYCBC_ERROR_MAP,
                                   AlreadyQueriedException,
                                   CouchbaseException,
                                   ErrorMapper,
-                                  ExceptionMap)
+                                  ExceptionMap,
+                                  TimeoutException)
 from couchbase.exceptions import exception as CouchbaseBaseException
 from couchbase.logic.n1ql import N1QLQuery  # noqa: F401
 from couchbase.logic.n1ql import QueryError  # noqa: F401
@@ -38,6 +46,9 @@ class N1QLRequest(QueryRequestLogic):
                  **kwargs
                  ):
         super().__init__(connection, query_params, row_factory=row_factory, **kwargs)
+        # rows are taken from the streamed result this many at a time when iterating, see set_fetch_size()
+        self._fetch_size = 1
+        self._row_buffer = deque()
 
     @classmethod
     def generate_n1ql_request(cls, connection, query_params, row_factory=lambda x: x, **kwargs):
@@ -46,6 +57,55 @@ class N1QLRequest(QueryRequestLogic):
     def execute(self):
         return [r for r in list(self)]
 
+    def set_fetch_size(self, fetch_size  # type: Optional[int]
+                       ) -> None:
+        if fetch_size is not None and fetch_size < 1:
+            raise ValueError('fetch_size must be a positive integer.')
+        self._fetch_size = fetch_size or 1
+
+    def fetch_many(self,
+                   count,  # type: int
+                   timeout=None  # type: Optional[timedelta]
+                   ) -> List[Any]:
+        if self.done_streaming:
+            return []
+
+        if not self.started_streaming:
+            self._submit_query()
+
+        raw_rows = []
+        while self._row_buffer and len(raw_rows) < count:
+            raw_rows.append(self._row_buffer.popleft())
+        if not raw_rows:
+            timeout_us = timedelta_as_microseconds(timeout) if timeout is not None else None
+            raw_rows = self._streaming_result.fetch_many(count, timeout_us)
+            if not raw_rows and self.done_streaming:
+                # cancelled while waiting
+                return []
+            if not raw_rows:
+                raise TimeoutException('Timeout occurred waiting for query rows.')
+
+        rows = []
+        for row in raw_rows:
+            if isinstance(row, CouchbaseBaseException):
+                raise ErrorMapper.build_exception(row)
+            if row is None:
+                self._done_streaming = True
+                self._get_metadata()
+                break
+            rows.append(self.serializer.deserialize(row))
+        return rows
+
+    def _next_raw_row(self):
+        if self._fetch_size == 1:
+            return next(self._streaming_result)
+        if not self._row_buffer:
+            # same as the iterator, nothing arriving before the timeout ends the rows
+            self._row_buffer.extend(self._streaming_result.fetch_many(self._fetch_size))
+            if not self._row_buffer:
+                raise StopIteration
+        return self._row_buffer.popleft()
+
     def _get_metadata(self):
         try:
             query_response = next(self._streaming_result)
@@ -68,9 +128,9 @@ class N1QLRequest(QueryRequestLogic):
 
     def _get_next_row(self):
         if self.done_streaming is True:
-            return
+            raise StopIteration
 
-        row = next(self._streaming_result)
+        row = self._next_raw_row()
         if isinstance(row, CouchbaseBaseException):
             raise ErrorMapper.build_exception(row)
         # should only be None one query request is complete and _no_ errors found
@@ -83,6 +143,9 @@ class N1QLRequest(QueryRequestLogic):
         try:
             return self._get_next_row()
         except StopIteration:
+            # already done (or cancelled, in which case there is no metadata)
+            if self.done_streaming:
+                raise
             self._done_streaming = True
             self._get_metadata()
             raise
@@ -324,7 +324,8 @@ class ClusterOptions(ClusterOptionsBase):
         serializer (:class:`~.serializer.Serializer`, optional): Global serializer to translate JSON to Python objects.
             Defaults to :class:`~.serializer.DefaultJsonSerializer`.
         transcoder (:class:`~.transcoder.Transcoder`, optional): Global transcoder to use for kv-operations.
-            Defaults to :class:`~.transcoder.JsonTranscoder`.
+            Defaults to :class:`~.transcoder.JsonTranscoder`.  Use :class:`~.transcoder.NativeJSONTranscoder` to
+            encode/decode JSON documents w/in the C++ extension.
         tcp_keep_alive_interval (timedelta, optional): TCP keep-alive interval. Defaults to None.
         config_poll_interval (timedelta, optional): Config polling floor interval.
             Defaults to None.
@@ -346,6 +347,12 @@ class ClusterOptions(ClusterOptionsBase):
             enabling the `logging_meter`.   Note when this is set, the `logging_meter_emit_interval` option is ignored.
         dns_nameserver (str, optional):  **VOLATILE** This API is subject to change at any time. Set to configure custom DNS nameserver. Defaults to None.
         dns_port (int, optional):  **VOLATILE** This API is subject to change at any time. Set to configure custom DNS port. Defaults to None.
+        io_sharding (bool, optional):  **VOLATILE** This API is subject to change at any time. Set to True to give each IO thread its own event loop and set of KV connections. Each IO thread then bootstraps separately and connects to every node, so the number of connections to the cluster is `num_io_threads + 1` times that of a non-sharded connection. Documents are assigned to IO threads by a hash of their key. `ping` and `diagnostics` report the endpoints of all of them. Defaults to False (disabled).
+        coalesce_reads (bool, optional):  **VOLATILE** This API is subject to change at any time. Set to True to send a single request for concurrent `get`/`exists` calls of the same document; callers that join an in-flight request share its timeout and result. Defaults to False (disabled).
+        hedge_reads_after (timedelta, optional):  **VOLATILE** This API is subject to change at any time. If a `get` has not completed after this long (e.g. the observed p95 latency), a replica read is sent as well and whichever succeeds first is returned, see `GetResult.is_replica`. Defaults to None (disabled).
+        stream_high_water_rows (int, optional):  **VOLATILE** This API is subject to change at any time. Maximum number of query/analytics rows received ahead of the row iterator. Once reached, reading the response pauses until the iterator has consumed half of them. Setting either mark opens a separate set of connections, served by an extra IO thread, for query/analytics streams, so that a paused stream does not hold up other operations. A paused stream can still hold up other streams, e.g. a query run for each row of another query. Defaults to None (unbounded).
+        stream_high_water_bytes (int, optional):  **VOLATILE** This API is subject to change at any time. Same as `stream_high_water_rows`, but bounds the total size (in bytes) of the buffered rows. Defaults to None (unbounded).
+        prepared_statement_cache_size (int, optional):  **VOLATILE** This API is subject to change at any time. Set to keep the names of up to this many prepared statements in the client; queries w/ `adhoc=False` prepare their statement once and run it by name afterwards. See `Cluster.prepare_statements` to prepare statements up front. Concurrent misses on a statement share a single PREPARE. Hit/miss/re-prepare counters are reported by the connection info. Defaults to None (disabled, prepared statements are handled by the core).
     """  # noqa: E501
 
     def apply_profile(self,
@@ -476,6 +483,8 @@ class GetOptions(GetOptionsBase):
             whole document.
         transcoder (:class:`~.transcoder.Transcoder`, optional): Specifies an explicit transcoder
             to use for this specific operation. Defaults to :class:`~.transcoder.JsonTranscoder`.
+        miss_as_none (bool, optional): If True, a document that does not exist is returned as None instead of
+            raising a :class:`~couchbase.exceptions.DocumentNotFoundException`. Defaults to False.
     """
 
 
@@ -841,6 +850,8 @@ class GetMultiOptions(dict):
         per_key_options (Dict[str, :class:`.GetOptions`], optional): Specify :class:`.GetOptions` per key.
         return_exceptions(bool, optional): If False, raise an Exception when encountered.  If True return the
             Exception without raising.  Default to True.
+        miss_as_none (bool, optional): If True, keys whose document does not exist map to None in the results
+            instead of to a :class:`~couchbase.exceptions.DocumentNotFoundException`. Defaults to False.
     """
     @overload
     def __init__(
@@ -850,7 +861,8 @@ class GetMultiOptions(dict):
         project=None,  # type: Iterable[str]
         transcoder=None,  # type: Transcoder
         per_key_options=None,       # type: Dict[str, GetOptions]
-        return_exceptions=None      # type: Optional[bool]
+        return_exceptions=None,      # type: Optional[bool]
+        miss_as_none=None  # type: Optional[bool]
     ):
         pass
 
@@ -861,7 +873,7 @@ class GetMultiOptions(dict):
     @classmethod
     def get_valid_keys(cls):
         return ['timeout', 'with_expiry', 'project', 'transcoder',
-                'per_key_options', 'return_exceptions']
+                'per_key_options', 'return_exceptions', 'miss_as_none']
 
 
 class ExistsMultiOptions(dict):
@@ -1253,6 +1265,88 @@ class PrependMultiOptions(dict):
                 'span', 'per_key_options', 'return_exceptions']
 
 
+class LookupInMultiOptions(dict):
+    """Available options to for a subdocument multi-lookup-in operation.
+
+    Options can be set at a global level (i.e. for all lookup-in operations handled with this multi-lookup-in
+    operation).  Use *per_key_options* to set specific :class:`.LookupInOptions` for specific keys.
+
+    Args:
+        timeout (timedelta, optional): The timeout for this operation. Defaults to global
+            key-value operation timeout.
+        access_deleted (bool, optional): Allows access to a deleted document's xattrs section.
+        per_key_options (Dict[str, :class:`.LookupInOptions`], optional): Specify :class:`.LookupInOptions` per
+            key.
+        return_exceptions(bool, optional): If False, raise an Exception when encountered.  If True return the
+            Exception without raising.  Default to True.
+    """
+    @overload
+    def __init__(
+        self,
+        timeout=None,  # type: Optional[timedelta]
+        access_deleted=None,  # type: Optional[bool]
+        per_key_options=None,       # type: Optional[Dict[str, LookupInOptions]]
+        return_exceptions=None      # type: Optional[bool]
+    ):
+        pass
+
+    def __init__(self, **kwargs):
+        kwargs = {k: v for k, v in kwargs.items() if v is not None}
+        super().__init__(**kwargs)
+
+    @classmethod
+    def get_valid_keys(cls):
+        return ['timeout', 'access_deleted', 'per_key_options', 'return_exceptions']
+
+
+class MutateInMultiOptions(dict):
+    """Available options to for a subdocument multi-mutate-in operation.
+
+    Options can be set at a global level (i.e. for all mutate-in operations handled with this multi-mutate-in
+    operation).  Use *per_key_options* to set specific :class:`.MutateInOptions` for specific keys.
+
+    Args:
+        timeout (timedelta, optional): The timeout for this operation. Defaults to global
+            key-value operation timeout.
+        expiry (timedelta, optional): Specifies the expiry time for the documents.
+        durability (:class:`~couchbase.durability.DurabilityType`, optional): Specifies the level of durability
+            for this operation.
+        preserve_expiry (bool, optional): Specifies that any existing expiry on the document should be preserved.
+        store_semantics (:class:`~couchbase.subdocument.StoreSemantics`, optional): Specifies how the documents
+            should be handled (replace, upsert or insert).
+        access_deleted (bool, optional): Allows access to a deleted document's xattrs section.
+        transcoder (:class:`~couchbase.transcoder.Transcoder`, optional): Specifies an explicit transcoder
+            to use for the spec values. Defaults to :class:`~.transcoder.JsonTranscoder`.
+        per_key_options (Dict[str, :class:`.MutateInOptions`], optional): Specify :class:`.MutateInOptions` per
+            key.
+        return_exceptions(bool, optional): If False, raise an Exception when encountered.  If True return the
+            Exception without raising.  Default to True.
+    """
+    @overload
+    def __init__(
+        self,
+        timeout=None,  # type: Optional[timedelta]
+        expiry=None,  # type: Optional[timedelta]
+        durability=None,  # type: Optional[DurabilityType]
+        preserve_expiry=None,  # type: Optional[bool]
+        store_semantics=None,  # type: Optional[StoreSemantics]
+        access_deleted=None,  # type: Optional[bool]
+        transcoder=None,  # type: Optional[Transcoder]
+        per_key_options=None,       # type: Optional[Dict[str, MutateInOptions]]
+        return_exceptions=None      # type: Optional[bool]
+    ):
+        pass
+
+    def __init__(self, **kwargs):
+        kwargs = {k: v for k, v in kwargs.items() if v is not None}
+        super().__init__(**kwargs)
+
+    @classmethod
+    def get_valid_keys(cls):
+        return ['timeout', 'expiry', 'durability', 'preserve_expiry', 'store_semantics', 'access_deleted', 'cas',
+                'transcoder', 'per_key_options', 'return_exceptions']
+
+
 NoValueMultiOptions = Union[GetMultiOptions, ExistsMultiOptions,
                             RemoveMultiOptions, TouchMultiOptions, LockMultiOptions, UnlockMultiOptions]
 MutationMultiOptions = Union[InsertMultiOptions, UpsertMultiOptions, ReplaceMultiOptions]
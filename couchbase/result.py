@@ -16,9 +16,10 @@
 from __future__ import annotations
 
 import json
-from datetime import datetime
+from datetime import datetime, timedelta
 from typing import (Any,
                     Dict,
+                    List,
                     Optional,
                     Tuple,
                     Union)
@@ -42,7 +43,7 @@ from couchbase.exceptions import (CLIENT_ERROR_MAP,
                                   PathNotFoundException,
                                   SubdocCantInsertValueException)
 from couchbase.exceptions import exception as CouchbaseBaseException
-from couchbase.pycbc_core import exception, result
+from couchbase.pycbc_core import exception, miss_result, result
 from couchbase.subdocument import SubDocStatus
 
 
@@ -64,28 +65,28 @@ class Result:
         """
             Optional[Any]: The content of the document, if it exists.
         """
-        return self._orig.raw_result.get("value", None)
+        return self._orig.get("value", None)
 
     @property
     def cas(self) -> Optional[int]:
         """
             Optional[int]: The CAS of the document, if it exists
         """
-        return self._orig.raw_result.get("cas", 0)
+        return self._orig.get("cas", 0)
 
     @property
     def flags(self) -> Optional[int]:
         """
             Optional[int]: Flags associated with the document.  Used for transcoding.
         """
-        return self._orig.raw_result.get("flags", 0)
+        return self._orig.get("flags", 0)
 
     @property
     def key(self) -> Optional[str]:
         """
             Optional[str]: Key for the operation, if it exists.
         """
-        return self._orig.raw_result.get("key", None)
+        return self._orig.get("key", None)
 
     @property
     def success(self) -> bool:
@@ -321,14 +322,14 @@ class GetReplicaResult(Result):
 
         bool: True if the result is the active document, False otherwise.
         """
-        return not self._orig.raw_result.get('is_replica')
+        return not self._orig.get('is_replica')
 
     @property
     def is_replica(self) -> bool:
         """
             bool: True if the result is a replica, False otherwise.
         """
-        return self._orig.raw_result.get('is_replica')
+        return self._orig.get('is_replica')
 
     @property
     def content_as(self) -> Any:
@@ -354,7 +355,7 @@ class GetResult(Result):
         """
             Optional[datetime]: The expiry of the document, if it was requested.
         """
-        time_ms = self._orig.raw_result.get("expiry", None)
+        time_ms = self._orig.get("expiry", None)
         if time_ms:
             return datetime.fromtimestamp(time_ms)
         return None
@@ -367,7 +368,7 @@ class GetResult(Result):
         Optional[datetime]: The expiry of the document, if it was requested.
         """
         # make this a datetime!
-        time_ms = self._orig.raw_result.get("expiry", None)
+        time_ms = self._orig.get("expiry", None)
         if time_ms:
             return datetime.fromtimestamp(time_ms)
         return None
@@ -405,6 +406,9 @@ class MultiResult:
                     raise ErrorMapper.build_exception(v)
                 else:
                     self._results[k] = ErrorMapper.build_exception(v)
+            elif isinstance(v, miss_result):
+                # miss_as_none, the document was not found
+                self._results[k] = None
             else:
                 if isinstance(v, list):
                     self._results[k] = v
@@ -426,7 +430,7 @@ class MultiResult:
         """
         exc = {}
         for k, v in self._results.items():
-            if not isinstance(v, self._result_type) and not isinstance(v, list):
+            if v is not None and not isinstance(v, self._result_type) and not isinstance(v, list):
                 exc[k] = v
         return exc
 
@@ -468,14 +472,14 @@ class MultiGetResult(MultiResult):
         super().__init__(orig, GetResult, return_exceptions)
 
     @property
-    def results(self) -> Dict[str, GetResult]:
+    def results(self) -> Dict[str, Optional[GetResult]]:
         """
-            Dict[str, :class:`.GetResult`]: Map of keys to their respective :class:`.GetResult`, if the
-                operation has a result.
+            Dict[str, Optional[:class:`.GetResult`]]: Map of keys to their respective :class:`.GetResult`, if the
+                operation has a result.  Keys that were not found map to None if the *miss_as_none* option was set.
         """
         res = {}
         for k, v in self._results.items():
-            if isinstance(v, GetResult):
+            if v is None or isinstance(v, GetResult):
                 res[k] = v
         return res
 
@@ -494,7 +498,7 @@ class ExistsResult(Result):
         """
             bool: True if the document exists, false otherwise.
         """
-        return self._orig.raw_result.get("exists", False)
+        return self._orig.get("exists", False)
 
     def __repr__(self):
         return "ExistsResult:{}".format(self._orig)
@@ -562,7 +566,6 @@ class MutationResult(Result):
                  orig,  # type: result
                  ):
         super().__init__(orig)
-        self._raw_mutation_token = self._orig.raw_result.get('mutation_token', None)
         self._mutation_token = None
 
     def mutation_token(self) -> Optional[MutationToken]:
@@ -571,8 +574,10 @@ class MutationResult(Result):
         Returns:
             Optional[:class:`.MutationToken`]: The operation's mutation token.
         """
-        if self._raw_mutation_token is not None and self._mutation_token is None:
-            self._mutation_token = MutationToken(self._raw_mutation_token.get())
+        if self._mutation_token is None:
+            raw_mutation_token = self._orig.get('mutation_token', None)
+            if raw_mutation_token is not None:
+                self._mutation_token = MutationToken(raw_mutation_token.get())
         return self._mutation_token
 
     def __repr__(self):
@@ -639,6 +644,51 @@ class MultiMutationResult:
 MultiResultType = Union[MultiGetResult, MultiMutationResult]
 
 
+class BulkMutationResult:
+    def __init__(self,
+                 orig,  # type: Dict[str, int]
+                 ):
+        self._orig = orig
+
+    @property
+    def submitted(self) -> int:
+        """
+            int: The number of operations submitted.
+        """
+        return self._orig.get('submitted', 0)
+
+    @property
+    def succeeded(self) -> int:
+        """
+            int: The number of operations that succeeded.
+        """
+        return self._orig.get('succeeded', 0)
+
+    @property
+    def failed(self) -> int:
+        """
+            int: The number of operations that failed.
+        """
+        return self._orig.get('failed', 0)
+
+    @property
+    def bytes_submitted(self) -> int:
+        """
+            int: The number of key and value bytes submitted.
+        """
+        return self._orig.get('bytes', 0)
+
+    @property
+    def all_ok(self) -> bool:
+        """
+            bool: True if all operations succeeded, false otherwise.
+        """
+        return self.failed == 0
+
+    def __repr__(self):
+        return f'BulkMutationResult:{self._orig}'
+
+
 class MutationToken:
     def __init__(self, token  # type: Dict[str, Union[str, int]]
                  ):
@@ -749,6 +799,52 @@ class MutateInResult(MutationResult):
         return "MutateInResult:{}".format(self._orig)
 
 
+class MultiLookupInResult(MultiResult):
+    def __init__(self,
+                 orig,  # type: result
+                 return_exceptions  # type: bool
+                 ):
+        super().__init__(orig, LookupInResult, return_exceptions)
+
+    @property
+    def results(self) -> Dict[str, LookupInResult]:
+        """
+            Dict[str, :class:`.LookupInResult`]: Map of keys to their respective :class:`.LookupInResult`, if the
+                operation has a result.
+        """
+        return {k: v for k, v in self._results.items() if isinstance(v, LookupInResult)}
+
+    def __repr__(self):
+        output_results = []
+        for k, v in self._results.items():
+            output_results.append(f'{k}:{v}')
+
+        return f'MultiLookupInResult( {", ".join(output_results)} )'
+
+
+class MultiMutateInResult(MultiResult):
+    def __init__(self,
+                 orig,  # type: result
+                 return_exceptions  # type: bool
+                 ):
+        super().__init__(orig, MutateInResult, return_exceptions)
+
+    @property
+    def results(self) -> Dict[str, MutateInResult]:
+        """
+            Dict[str, :class:`.MutateInResult`]: Map of keys to their respective :class:`.MutateInResult`, if the
+                operation has a result.
+        """
+        return {k: v for k, v in self._results.items() if isinstance(v, MutateInResult)}
+
+    def __repr__(self):
+        output_results = []
+        for k, v in self._results.items():
+            output_results.append(f'{k}:{v}')
+
+        return f'MultiMutateInResult( {", ".join(output_results)} )'
+
+
 class CounterResult(MutationResult):
 
     # Uncomment and delete previous property when ready to remove cas CounterResult.
@@ -762,7 +858,7 @@ class CounterResult(MutationResult):
 
             int: **DEPRECATED** The CAS of the document.
         """
-        return self._orig.raw_result.get("cas", 0)
+        return self._orig.get("cas", 0)
 
     @property
     def content(self) -> Optional[int]:
@@ -962,19 +1058,59 @@ class QueryResult:
     ):
         self._request = n1ql_request
 
-    def rows(self):
+    def rows(self, fetch_size=None  # type: Optional[int]
+             ):
         """The rows which have been returned by the query.
 
         .. note::
             If using the *acouchbase* API be sure to use ``async for`` when looping over rows.
 
+        Args:
+            fetch_size (int, optional): **VOLATILE** This API is subject to change at any time. Take up to this many
+                rows at once from the underlying stream while iterating, instead of one at a time. Only applies to
+                the *couchbase* API.
+
         Returns:
             Iterable: Either an iterable or async iterable.
         """
         if isinstance(self._request, AsyncN1QLRequest):
             return self.__aiter__()
+        if fetch_size is not None:
+            self._request.set_fetch_size(fetch_size)
         return self.__iter__()
 
+    def fetch_many(self,
+                   count,  # type: int
+                   timeout=None  # type: Optional[timedelta]
+                   ) -> List[Any]:
+        """**VOLATILE** This API is subject to change at any time.
+
+        Returns up to count rows, only waiting for the first of them; the others are rows which have been received
+        already.  An empty list is returned once all rows have been returned.
+
+        .. note::
+            Not available w/ the *acouchbase* API.
+
+        Args:
+            count (int): Maximum number of rows to return.
+            timeout (timedelta, optional): How long to wait for the first row. Defaults to the query timeout.
+
+        Returns:
+            List[Any]: The next rows of the query.
+
+        Raises:
+            :class:`~couchbase.exceptions.TimeoutException`: If no row arrived within the timeout.
+
+        Example:
+            result = cluster.query('SELECT * FROM `travel-sample` LIMIT 1000;')
+            rows = result.fetch_many(100)
+            while rows:
+                process(rows)
+                rows = result.fetch_many(100)
+
+        """
+        return self._request.fetch_many(count, timeout=timeout)
+
     def execute(self):
         """Convenience method to execute the query.
 
@@ -987,6 +1123,17 @@ class QueryResult:
         """
         return self._request.execute()
 
+    def cancel(self) -> None:
+        """**VOLATILE** This API is subject to change at any time.
+
+        Stops the query: the rest of the response is not read, rows which have not been returned yet are dropped
+        and iterating over :meth:`rows` stops right away.  :meth:`metadata` returns None afterwards.
+
+        .. note::
+            Dropping the result before all rows have been read has the same effect.
+        """
+        self._request.cancel()
+
     def metadata(self):
         """The meta-data which has been returned by the query.
 
@@ -1028,6 +1175,17 @@ class AnalyticsResult:
             return self.__aiter__()
         return self.__iter__()
 
+    def cancel(self) -> None:
+        """**VOLATILE** This API is subject to change at any time.
+
+        Stops the analytics query: the rest of the response is not read, rows which have not been returned yet are
+        dropped and iterating over :meth:`rows` stops right away.  :meth:`metadata` returns None afterwards.
+
+        .. note::
+            Dropping the result before all rows have been read has the same effect.
+        """
+        self._request.cancel()
+
     def metadata(self):
         """The meta-data which has been returned by the analytics query.
 
@@ -1067,6 +1225,18 @@ class SearchResult:
             return self.__aiter__()
         return self.__iter__()
 
+    def cancel(self) -> None:
+        """**VOLATILE** This API is subject to change at any time.
+
+        Stops the search query: rows which have not been returned yet are dropped and iterating over :meth:`rows`
+        stops right away.  :meth:`metadata` returns None afterwards.  Search responses are only handed over once
+        complete, so the request itself runs to its end.
+
+        .. note::
+            Dropping the result before all rows have been read has the same effect.
+        """
+        self._request.cancel()
+
     def metadata(self):
         """The meta-data which has been returned by the search query.
 
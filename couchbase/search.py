@@ -104,7 +104,7 @@ class SearchRequest(SearchRequestLogic):
 
     def _get_next_row(self):
         if self.done_streaming is True:
-            return
+            raise StopIteration
 
         row = next(self._streaming_result)
         if isinstance(row, CouchbaseBaseException):
@@ -119,6 +119,9 @@ class SearchRequest(SearchRequestLogic):
         try:
             return self._get_next_row()
         except StopIteration:
+            # already done (or cancelled, in which case there is no metadata)
+            if self.done_streaming:
+                raise
             self._done_streaming = True
             self._get_metadata()
             raise
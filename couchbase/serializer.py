@@ -17,6 +17,8 @@ import json
 from abc import ABC, abstractmethod
 from typing import Any
 
+from couchbase.pycbc_core import json_decode, json_encode
+
 
 class Serializer(ABC):
     """Interface a Custom Serializer must implement
@@ -54,3 +56,23 @@ class DefaultJsonSerializer(Serializer):
                     ) -> Any:
 
         return json.loads(value.decode('utf-8'))
+
+
+class NativeJsonSerializer(Serializer):
+    """JSON serializer implemented in the C++ extension.
+
+    Serializes dict, list, tuple, str, int, float, bool and None directly to UTF-8 encoded bytes (without
+    whitespace) and parses documents directly into Python objects, avoiding the overhead of Python's json module.
+    """
+
+    def serialize(self,
+                  value,  # type: Any
+                  ) -> bytes:
+
+        return json_encode(value)
+
+    def deserialize(self,
+                    value  # type: bytes
+                    ) -> Any:
+
+        return json_decode(value)
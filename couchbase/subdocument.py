@@ -13,18 +13,26 @@
 #  See the License for the specific language governing permissions and
 #  limitations under the License.
 
+from __future__ import annotations
+
+import json
+from copy import copy
 from enum import IntEnum
 from typing import (TYPE_CHECKING,
                     Any,
                     Dict,
                     Iterable,
-                    Optional)
+                    Optional,
+                    Tuple)
 
 from couchbase.exceptions import InvalidArgumentException
 from couchbase.logic.supportability import Supportability
+from couchbase.pycbc_core import subdoc_spec
+from couchbase.transcoder import JSONTranscoder
 
 if TYPE_CHECKING:
     from couchbase._utils import JSONType
+    from couchbase.transcoder import Transcoder
 
 """
 couchbase++ couchbase/protocol/client_opcode.hxx
@@ -527,6 +535,126 @@ def with_expiry() -> Spec:
     return Spec(SubDocOp.GET, '$document.exptime', True)
 
 
+_LOOKUP_IN_OPS = (SubDocOp.GET_DOC, SubDocOp.GET, SubDocOp.EXISTS, SubDocOp.GET_COUNT)
+_ARRAY_MULTI_VALUE_OPS = (SubDocOp.ARRAY_PUSH_FIRST,
+                          SubDocOp.ARRAY_PUSH_LAST,
+                          SubDocOp.ARRAY_ADD_UNIQUE,
+                          SubDocOp.ARRAY_INSERT)
+
+
+def encode_spec_value(op,  # type: SubDocOp
+                      value,  # type: Any
+                      transcoder  # type: Transcoder
+                      ) -> bytes:
+    """**INTERNAL**
+    Encodes the value of a mutate_in spec.
+    """
+    if op in _ARRAY_MULTI_VALUE_OPS:
+        new_value = json.dumps(value, ensure_ascii=False)
+        # this is an array, need to remove brackets
+        return new_value[1:len(new_value)-1].encode('utf-8')
+    # no need to propagate the flags
+    return transcoder.encode_value(value)[0]
+
+
+class CompiledSpec:
+    """A list of lookup-in or mutate-in :class:`.Spec` compiled once into the representation used by the C++
+    client, so repeated operations do not have to parse the specs again.
+
+    A compiled spec is immutable and can be reused across calls and threads.  For mutate-in specs the values the
+    spec was created with are encoded once; use :meth:`bind` to provide new values for a call.
+
+    Args:
+        spec (Iterable[:class:`.Spec`]): The specs to compile.  Lookup-in and mutate-in specs cannot be mixed.
+        transcoder (:class:`~couchbase.transcoder.Transcoder`, optional): Transcoder used to encode mutate-in
+            values.  Defaults to :class:`~couchbase.transcoder.JSONTranscoder`.
+
+    Raises:
+        :class:`~couchbase.exceptions.InvalidArgumentException`: If no specs are provided or if lookup-in and
+            mutate-in specs are mixed.
+
+    Examples:
+
+        Reuse a lookup-in spec::
+
+            import couchbase.subdocument as SD
+
+            # ... other code ...
+
+            spec = SD.CompiledSpec([SD.get('geo.lat'), SD.get('geo.lon')])
+            for key in keys:
+                res = collection.lookup_in(key, spec)
+
+        Bind new values to a mutate-in spec::
+
+            spec = SD.CompiledSpec([SD.upsert('status', ''), SD.increment('visits', 1)])
+            res = collection.mutate_in(key, spec.bind('active', 1))
+    """
+
+    def __init__(self,
+                 spec,  # type: Iterable[Spec]
+                 transcoder=None  # type: Optional[Transcoder]
+                 ):
+        spec = tuple(spec)
+        if len(spec) == 0:
+            raise InvalidArgumentException('Cannot compile an empty spec.')
+        is_lookup = [s[0] in _LOOKUP_IN_OPS for s in spec]
+        if any(is_lookup) and not all(is_lookup):
+            raise InvalidArgumentException('Cannot compile a spec that mixes lookup-in and mutate-in operations.')
+
+        self._transcoder = transcoder if transcoder is not None else JSONTranscoder()
+        self._ops = tuple(s[0] for s in spec)
+        # ops of the specs that carry a value, in the order bind() expects their values
+        self._value_ops = tuple(s[0] for s in spec if len(s) == 6)
+        is_mutation = not all(is_lookup)
+        if is_mutation:
+            spec = tuple(tuple(s[:5]) + (encode_spec_value(s[0], s[5], self._transcoder),) if len(s) == 6 else s
+                         for s in spec)
+        self._spec = subdoc_spec(spec, is_mutation)
+
+    @property
+    def is_mutation(self) -> bool:
+        """
+            bool: True if this is a compiled mutate-in spec, False for a lookup-in spec.
+        """
+        return self._spec.is_mutation
+
+    @property
+    def ops(self) -> Tuple[SubDocOp, ...]:
+        """
+            Tuple[:class:`.SubDocOp`, ...]: The operation of each spec.
+        """
+        return self._ops
+
+    def bind(self, *values  # type: Any
+             ) -> CompiledSpec:
+        """Returns a copy of this (mutate-in) spec with new values, the compiled spec is shared.
+
+        Args:
+            values (Any): One value for each spec that takes a value, in spec order.
+
+        Returns:
+            :class:`.CompiledSpec`: The spec with the provided values bound.
+
+        Raises:
+            :class:`~couchbase.exceptions.InvalidArgumentException`: If the number of values does not match.
+        """
+        if len(values) != len(self._value_ops):
+            raise InvalidArgumentException(
+                f'Expected {len(self._value_ops)} value(s) to bind, got {len(values)}.')
+        bound = copy(self)
+        bound._spec = self._spec.bind(tuple(encode_spec_value(op, v, self._transcoder)
+                                            for op, v in zip(self._value_ops, values)))
+        return bound
+
+    def __len__(self):
+        return len(self._ops)
+
+    def __repr__(self):
+        ops = [getattr(op, 'name', op) for op in self._ops]
+        return f'CompiledSpec(is_mutation={self.is_mutation}, ops={ops})'
+
+
 """
 ** DEPRECATION NOTICE **
 
@@ -47,6 +47,7 @@ class ClusterDiagnosticsTestSuite:
         'test_ping',
         'test_ping_as_json',
         'test_ping_invalid_services',
+        'test_ping_io_sharding',
         'test_ping_mixed_services',
         'test_ping_report_id',
         'test_ping_restrict_services',
@@ -197,6 +198,26 @@ class ClusterDiagnosticsTestSuite:
         with pytest.raises(InvalidArgumentException):
             cluster.ping(PingOptions(service_types=ServiceType.KeyValue))
 
+    # creating a new connection, allow retries
+    @pytest.mark.usefixtures('check_diagnostics_supported')
+    @pytest.mark.flaky(reruns=5, reruns_delay=1)
+    def test_ping_io_sharding(self, cb_env):
+        conn_string = cb_env.config.get_connection_string()
+        username, pw = cb_env.config.get_username_and_pw()
+        kv_endpoints = []
+        for io_sharding in [False, True]:
+            opts = ClusterOptions(PasswordAuthenticator(username, pw), num_io_threads=2, io_sharding=io_sharding)
+            cluster = Cluster.connect(conn_string, opts)
+            try:
+                cluster.bucket(cb_env.bucket.name)
+                result = cluster.ping(PingOptions(service_types=[ServiceType.KeyValue]))
+                kv_endpoints.append(len(result.endpoints.get(ServiceType.KeyValue, [])))
+            finally:
+                cluster.close()
+        assert kv_endpoints[0] > 0
+        # the primary cluster's connections and those of both IO threads
+        assert kv_endpoints[1] == 3 * kv_endpoints[0]
+
     @pytest.mark.usefixtures('check_diagnostics_supported')
     def test_ping_mixed_services(self, cb_env):
         cluster = cb_env.cluster
@@ -17,28 +17,40 @@ from datetime import timedelta
 
 import pytest
 
+import couchbase.subdocument as SD
+from couchbase.auth import PasswordAuthenticator
+from couchbase.cluster import Cluster
 from couchbase.diagnostics import ServiceType
 from couchbase.exceptions import (CouchbaseException,
                                   DocumentExistsException,
                                   DocumentNotFoundException,
                                   DocumentUnretrievableException,
                                   InvalidArgumentException)
-from couchbase.options import (GetAnyReplicaMultiOptions,
+from couchbase.options import (ClusterOptions,
+                               GetAnyReplicaMultiOptions,
                                GetMultiOptions,
                                InsertMultiOptions,
                                InsertOptions,
+                               LookupInMultiOptions,
+                               MutateInMultiOptions,
                                ReplaceMultiOptions,
                                TouchMultiOptions,
                                UpsertMultiOptions,
                                UpsertOptions)
-from couchbase.result import (ExistsResult,
+from couchbase.result import (BulkMutationResult,
+                              ExistsResult,
                               GetReplicaResult,
                               GetResult,
+                              LookupInResult,
                               MultiExistsResult,
                               MultiGetReplicaResult,
                               MultiGetResult,
+                              MultiLookupInResult,
+                              MultiMutateInResult,
                               MultiMutationResult,
+                              MutateInResult,
                               MutationResult)
+from couchbase.transcoder import RawBinaryTranscoder
 from tests.environments import CollectionType
 from tests.environments.collection_multi_environment import CollectionMultiTestEnvironment
 from tests.environments.test_environment import TestEnvironment
@@ -58,8 +70,11 @@ class CollectionMultiTestSuite:
         'test_multi_get_any_replica_invalid_input',
         'test_multi_get_any_replica_simple',
         'test_multi_get_fail',
+        'test_multi_get_hedged_not_before_submit',
         'test_multi_get_invalid_input',
+        'test_multi_get_miss_as_none',
         'test_multi_get_simple',
+        'test_multi_get_stream',
         'test_multi_insert_fail',
         'test_multi_insert_global_opts',
         'test_multi_insert_invalid_input',
@@ -67,6 +82,10 @@ class CollectionMultiTestSuite:
         'test_multi_insert_simple',
         'test_multi_lock_and_unlock_simple',
         'test_multi_lock_invalid_input',
+        'test_multi_lookup_in_fail',
+        'test_multi_lookup_in_simple',
+        'test_multi_mutate_in_fail',
+        'test_multi_mutate_in_simple',
         'test_multi_remove_fail',
         'test_multi_remove_invalid_input',
         'test_multi_remove_simple',
@@ -79,10 +98,13 @@ class CollectionMultiTestSuite:
         'test_multi_touch_invalid_input',
         'test_multi_touch_simple',
         'test_multi_unlock_invalid_input',
+        'test_multi_upsert_bulk',
+        'test_multi_upsert_bulk_buffer_bytes',
         'test_multi_upsert_global_opts',
         'test_multi_upsert_invalid_input',
         'test_multi_upsert_key_opts',
         'test_multi_upsert_simple',
+        'test_multi_upsert_stream',
     ]
 
     @pytest.fixture(scope='class')
@@ -246,6 +268,25 @@ class CollectionMultiTestSuite:
         with pytest.raises(DocumentNotFoundException):
             cb_env.collection.get_multi(keys, GetMultiOptions(return_exceptions=False))
 
+    # creating a new connection, allow retries
+    @pytest.mark.flaky(reruns=5, reruns_delay=1)
+    def test_multi_get_hedged_not_before_submit(self, cb_env):
+        keys_and_docs = cb_env.get_docs(200)
+        keys = list(keys_and_docs.keys())
+        conn_string = cb_env.config.get_connection_string()
+        username, pw = cb_env.config.get_username_and_pw()
+        opts = ClusterOptions(PasswordAuthenticator(username, pw), hedge_reads_after=timedelta(milliseconds=500))
+        cluster = Cluster.connect(conn_string, opts)
+        try:
+            collection = cluster.bucket(cb_env.bucket.name).scope(cb_env.scope.name).collection(cb_env.collection.name)
+            for _ in range(5):
+                res = collection.get_multi(keys)
+                assert res.all_ok is True
+            # the hedge timer starts once a read is sent, a batch answered w/in the threshold is never hedged
+            assert cluster._get_client_connection_info()['hedged_reads'] == 0
+        finally:
+            cluster.close()
+
     def test_multi_get_invalid_input(self, cb_env):
         keys_and_docs = {
             'test-key1': {'what': 'a test doc!', 'id': 'test-key1'},
@@ -256,6 +297,20 @@ class CollectionMultiTestSuite:
         with pytest.raises(InvalidArgumentException):
             cb_env.collection.get_multi(keys_and_docs)
 
+    def test_multi_get_miss_as_none(self, cb_env):
+        keys_and_docs = cb_env.get_docs(2)
+        keys = list(keys_and_docs.keys()) + list(cb_env.FAKE_DOCS.keys())
+        res = cb_env.collection.get_multi(keys, GetMultiOptions(miss_as_none=True))
+        assert isinstance(res, MultiGetResult)
+        assert res.all_ok is True
+        assert res.exceptions == {}
+        assert set(res.results.keys()) == set(keys)
+        for k, v in res.results.items():
+            if k in keys_and_docs:
+                assert v.content_as[dict] == keys_and_docs[k]
+            else:
+                assert v is None
+
     def test_multi_get_simple(self, cb_env):
         keys_and_docs = cb_env.get_docs(4)
         keys = list(keys_and_docs.keys())
@@ -268,6 +323,18 @@ class CollectionMultiTestSuite:
         for k, v in res.results.items():
             assert v.content_as[dict] == keys_and_docs[k]
 
+    def test_multi_get_stream(self, cb_env):
+        keys_and_docs = cb_env.get_docs(4)
+        keys = list(keys_and_docs.keys()) + list(cb_env.FAKE_DOCS.keys())
+        results = dict(cb_env.collection.get_multi_stream(keys))
+        assert set(results.keys()) == set(keys)
+        for k, v in results.items():
+            if k in keys_and_docs:
+                assert isinstance(v, GetResult)
+                assert v.content_as[dict] == keys_and_docs[k]
+            else:
+                assert isinstance(v, DocumentNotFoundException)
+
     def test_multi_insert_fail(self, cb_env):
         keys_and_docs = cb_env.get_docs(4)
         res = cb_env.collection.insert_multi(keys_and_docs)
@@ -346,6 +413,63 @@ class CollectionMultiTestSuite:
         with pytest.raises(InvalidArgumentException):
             cb_env.collection.lock_multi(keys_and_docs, timedelta(seconds=5))
 
+    def test_multi_lookup_in_fail(self, cb_env):
+        spec = (SD.get('batch'),)
+        keys_and_specs = {k: spec for k in cb_env.FAKE_DOCS.keys()}
+        res = cb_env.collection.lookup_in_multi(keys_and_specs)
+        assert isinstance(res, MultiLookupInResult)
+        assert res.all_ok is False
+        assert res.results == {}
+        assert isinstance(res.exceptions, dict)
+        assert all(map(lambda e: issubclass(type(e), CouchbaseException), res.exceptions.values())) is True
+
+        with pytest.raises(DocumentNotFoundException):
+            cb_env.collection.lookup_in_multi(keys_and_specs, return_exceptions=False)
+
+        with pytest.raises(DocumentNotFoundException):
+            cb_env.collection.lookup_in_multi(keys_and_specs, LookupInMultiOptions(return_exceptions=False))
+
+    def test_multi_lookup_in_simple(self, cb_env):
+        keys_and_docs = cb_env.get_docs(4)
+        spec = (SD.exists('batch'), SD.get('batch'))
+        for k in keys_and_docs.keys():
+            cb_env.collection.mutate_in(k, (SD.upsert('batch', {'key': k}),))
+        res = cb_env.collection.lookup_in_multi({k: spec for k in keys_and_docs.keys()})
+        assert isinstance(res, MultiLookupInResult)
+        assert res.all_ok is True
+        assert res.exceptions == {}
+        assert all(map(lambda r: isinstance(r, LookupInResult), res.results.values())) is True
+        for k, v in res.results.items():
+            assert v.exists(0) is True
+            assert v.content_as[dict](1) == {'key': k}
+
+    def test_multi_mutate_in_fail(self, cb_env):
+        spec = (SD.upsert('batch', 'value'),)
+        keys_and_specs = {k: spec for k in cb_env.FAKE_DOCS.keys()}
+        res = cb_env.collection.mutate_in_multi(keys_and_specs)
+        assert isinstance(res, MultiMutateInResult)
+        assert res.all_ok is False
+        assert res.results == {}
+        assert isinstance(res.exceptions, dict)
+        assert all(map(lambda e: issubclass(type(e), CouchbaseException), res.exceptions.values())) is True
+
+        with pytest.raises(DocumentNotFoundException):
+            cb_env.collection.mutate_in_multi(keys_and_specs, MutateInMultiOptions(return_exceptions=False))
+
+    def test_multi_mutate_in_simple(self, cb_env):
+        keys_and_docs = cb_env.get_docs(4)
+        spec = (SD.upsert('batch', 'value'), SD.array_append('batch_list', 1, create_parents=True))
+        res = cb_env.collection.mutate_in_multi({k: spec for k in keys_and_docs.keys()})
+        assert isinstance(res, MultiMutateInResult)
+        assert res.all_ok is True
+        assert res.exceptions == {}
+        assert all(map(lambda r: isinstance(r, MutateInResult), res.results.values())) is True
+        for k, v in res.results.items():
+            assert v.cas is not None
+            get_res = cb_env.collection.get(k)
+            assert get_res.content_as[dict]['batch'] == 'value'
+            assert get_res.content_as[dict]['batch_list'] == [1]
+
     def test_multi_remove_fail(self, cb_env):
         keys_and_docs = cb_env.FAKE_DOCS
         keys = list(keys_and_docs.keys())
@@ -540,6 +664,42 @@ class CollectionMultiTestSuite:
         assert res.exceptions == {}
         assert all(map(lambda r: isinstance(r, MutationResult), res.results.values())) is True
 
+    def test_multi_upsert_bulk(self, cb_env):
+        keys_and_docs = cb_env.get_docs(4)
+        progress = []
+        errors = {}
+        res = cb_env.collection.upsert_bulk(iter(keys_and_docs.items()),
+                                            max_in_flight=2,
+                                            error_handler=lambda k, e: errors.update({k: e}),
+                                            progress_handler=progress.append)
+        assert isinstance(res, BulkMutationResult)
+        assert res.all_ok is True
+        assert res.submitted == len(keys_and_docs)
+        assert res.succeeded == len(keys_and_docs)
+        assert errors == {}
+        assert len(progress) > 0
+        for k, v in keys_and_docs.items():
+            assert cb_env.collection.get(k).content_as[dict] == v
+
+    def test_multi_upsert_bulk_buffer_bytes(self, cb_env):
+        keys = list(cb_env.get_docs(4).keys())
+        values = [bytearray(b'x' * (100 * (i + 1))) for i in range(len(keys))]
+        res = cb_env.collection.upsert_bulk(zip(keys, values),
+                                            UpsertMultiOptions(transcoder=RawBinaryTranscoder()),
+                                            max_in_flight=2,
+                                            max_bytes=150)
+        assert res.all_ok is True
+        # values are counted through the buffer protocol, not only when they are bytes
+        assert res.bytes_submitted == sum(len(k) for k in keys) + sum(len(v) for v in values)
+        for k, v in zip(keys, values):
+            assert cb_env.collection.get(k, transcoder=RawBinaryTranscoder()).content_as[bytes] == bytes(v)
+
+    def test_multi_upsert_stream(self, cb_env):
+        keys_and_docs = cb_env.get_docs(4)
+        results = dict(cb_env.collection.upsert_multi_stream(keys_and_docs))
+        assert set(results.keys()) == set(keys_and_docs.keys())
+        assert all(map(lambda r: isinstance(r, MutationResult), results.values())) is True
+
 
 class ClassicCollectionMultiTests(CollectionMultiTestSuite):
 
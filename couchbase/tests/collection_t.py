@@ -13,12 +13,15 @@
 #  See the License for the specific language governing permissions and
 #  limitations under the License.
 
+import threading
 from datetime import datetime, timedelta
 from time import time
 
 import pytest
 
 import couchbase.subdocument as SD
+from couchbase.auth import PasswordAuthenticator
+from couchbase.cluster import Cluster
 from couchbase.diagnostics import ServiceType
 from couchbase.exceptions import (AmbiguousTimeoutException,
                                   CasMismatchException,
@@ -27,8 +30,10 @@ from couchbase.exceptions import (AmbiguousTimeoutException,
                                   DocumentNotFoundException,
                                   DocumentUnretrievableException,
                                   InvalidArgumentException,
+                                  KeyValueErrorContext,
                                   TemporaryFailException)
-from couchbase.options import (GetOptions,
+from couchbase.options import (ClusterOptions,
+                               GetOptions,
                                InsertOptions,
                                ReplaceOptions,
                                UpsertOptions)
@@ -53,6 +58,7 @@ class CollectionTestSuite:
         'test_expiry_really_expires',
         'test_get',
         'test_get_after_lock',
+        'test_get_raw_result',
         'test_get_all_replicas',
         'test_get_all_replicas_fail',
         'test_get_all_replicas_results',
@@ -60,11 +66,19 @@ class CollectionTestSuite:
         'test_get_and_lock_replace_with_cas',
         'test_get_and_touch',
         'test_get_and_touch_no_expire',
+        'test_get_coalesced_read_your_writes',
         'test_get_any_replica',
         'test_get_any_replica_fail',
         'test_get_fails',
+        'test_get_fails_error_context',
+        'test_get_miss_as_none',
         'test_get_options',
+        'test_get_read_cache',
+        'test_get_read_cache_after_lock',
+        'test_get_read_cache_large_document',
         'test_get_with_expiry',
+        'test_handle_kv_ops',
+        'test_handle_kv_ops_fail',
         'test_insert',
         'test_insert_document_exists',
         'test_project',
@@ -86,6 +100,7 @@ class CollectionTestSuite:
         'test_upsert',
         'test_upsert_preserve_expiry',
         'test_upsert_preserve_expiry_not_used',
+        'test_upsert_raw_result',
     ]
 
     @pytest.fixture(scope='class')
@@ -184,6 +199,17 @@ class CollectionTestSuite:
         assert result.expiry_time is None
         assert result.content_as[dict] == value
 
+    def test_get_raw_result(self, cb_env):
+        key, value = cb_env.get_existing_doc()
+        result = cb_env.collection.get(key)
+        # fields are created on access, raw_result has to provide all of them
+        raw_result = result._orig.raw_result
+        assert raw_result['key'] == key
+        assert raw_result['cas'] == result.cas
+        assert raw_result['flags'] == result.flags
+        assert raw_result['value'] == value
+        assert result.content_as[dict] == value
+
     def test_get_after_lock(self, cb_env):
         key = cb_env.get_existing_doc(key_only=True)
         orig = cb_env.collection.get_and_lock(key, timedelta(seconds=5))
@@ -297,6 +323,35 @@ class CollectionTestSuite:
         g_result = cb_env.collection.get(key, GetOptions(with_expiry=True))
         assert g_result.expiry_time is None
 
+    # creating a new connection, allow retries
+    @pytest.mark.flaky(reruns=5, reruns_delay=1)
+    def test_get_coalesced_read_your_writes(self, cb_env):
+        key = cb_env.get_new_doc(key_only=True)
+        conn_string = cb_env.config.get_connection_string()
+        username, pw = cb_env.config.get_username_and_pw()
+        cluster = Cluster.connect(conn_string, ClusterOptions(PasswordAuthenticator(username, pw), coalesce_reads=True))
+        done = threading.Event()
+        try:
+            collection = cluster.bucket(cb_env.bucket.name).scope(cb_env.scope.name).collection(cb_env.collection.name)
+            collection.upsert(key, {'version': 0})
+
+            # keeps a read of the document in flight most of the time, for the writer's reads to attach to
+            def read_loop():
+                while not done.is_set():
+                    collection.get(key)
+
+            reader = threading.Thread(target=read_loop)
+            reader.start()
+            try:
+                for version in range(1, 50):
+                    collection.upsert(key, {'version': version})
+                    assert collection.get(key).content_as[dict] == {'version': version}
+            finally:
+                done.set()
+                reader.join()
+        finally:
+            cluster.close()
+
     @pytest.mark.usefixtures("check_replicas")
     def test_get_any_replica(self, cb_env):
         key, value = cb_env.get_existing_doc()
@@ -324,6 +379,88 @@ class CollectionTestSuite:
         with pytest.raises(DocumentNotFoundException):
             cb_env.collection.get(TestEnvironment.NOT_A_KEY)
 
+    def test_get_fails_error_context(self, cb_env):
+        with pytest.raises(DocumentNotFoundException) as ex:
+            cb_env.collection.get(TestEnvironment.NOT_A_KEY)
+        # the context is built from the C++ error context on first access
+        ctx = ex.value.error_context
+        assert isinstance(ctx, KeyValueErrorContext)
+        assert ctx.key == TestEnvironment.NOT_A_KEY
+        assert ctx.bucket_name == cb_env.bucket.name
+        assert 'C Source=' in repr(ex.value)
+
+    def test_get_miss_as_none(self, cb_env):
+        assert cb_env.collection.get(TestEnvironment.NOT_A_KEY, GetOptions(miss_as_none=True)) is None
+        assert cb_env.collection.get(TestEnvironment.NOT_A_KEY, miss_as_none=True, project=['id']) is None
+        key, value = cb_env.get_existing_doc()
+        result = cb_env.collection.get(key, GetOptions(miss_as_none=True))
+        assert isinstance(result, GetResult)
+        assert result.content_as[dict] == value
+
+    def test_get_read_cache(self, cb_env):
+        key, value = cb_env.get_existing_doc()
+        cb_env.collection.enable_read_cache(1024 * 1024, timedelta(seconds=30))
+        try:
+            cache_name = f'{cb_env.bucket.name}/{cb_env.scope.name}/{cb_env.collection.name}'
+            result = cb_env.collection.get(key)
+            assert result.content_as[dict] == value
+            cached = cb_env.collection.get(key)
+            assert cached.cas == result.cas
+            assert cached.content_as[dict] == value
+            counters = cb_env.cluster._get_client_connection_info()['read_caches'][cache_name]
+            assert counters['hits'] == 1
+            assert counters['misses'] == 1
+            assert counters['entries'] == 1
+            # a mutation through the SDK drops the cached document
+            new_value = dict(value, cached=False)
+            cb_env.collection.upsert(key, new_value)
+            assert cb_env.collection.get(key).content_as[dict] == new_value
+        finally:
+            cb_env.collection.disable_read_cache()
+            cb_env.collection.upsert(key, value)
+        assert cache_name not in cb_env.cluster._get_client_connection_info()['read_caches']
+
+    def test_get_read_cache_after_lock(self, cb_env):
+        key, value = cb_env.get_existing_doc()
+        cb_env.collection.enable_read_cache(1024 * 1024, timedelta(seconds=30))
+        try:
+            cached = cb_env.collection.get(key)
+            # the lock changes the CAS, the cached document has to be dropped
+            locked = cb_env.collection.get_and_lock(key, timedelta(seconds=5))
+            assert locked.cas != cached.cas
+            result = cb_env.collection.get(key)
+            assert result.cas != cached.cas
+            TestEnvironment.try_n_times_till_exception(10,
+                                                       1,
+                                                       cb_env.collection.unlock,
+                                                       key,
+                                                       locked.cas,
+                                                       expected_exceptions=(TemporaryFailException,))
+            # so does touch, a replace w/ the CAS read afterwards succeeds
+            cb_env.collection.get(key)
+            cb_env.collection.touch(key, timedelta(seconds=1000))
+            result = cb_env.collection.get(key)
+            cb_env.collection.replace(key, value, ReplaceOptions(cas=result.cas))
+        finally:
+            cb_env.collection.disable_read_cache()
+
+    def test_get_read_cache_large_document(self, cb_env):
+        key = cb_env.get_new_doc(key_only=True)
+        # larger than a single shard's share of max_bytes, still has to be cached
+        value = {'data': 'a' * 4096}
+        cb_env.collection.upsert(key, value)
+        cb_env.collection.enable_read_cache(16 * 1024, timedelta(seconds=30))
+        try:
+            cache_name = f'{cb_env.bucket.name}/{cb_env.scope.name}/{cb_env.collection.name}'
+            cb_env.collection.get(key)
+            assert cb_env.collection.get(key).content_as[dict] == value
+            counters = cb_env.cluster._get_client_connection_info()['read_caches'][cache_name]
+            assert counters['hits'] == 1
+            assert counters['entries'] == 1
+        finally:
+            cb_env.collection.disable_read_cache()
+            cb_env.collection.remove(key)
+
     @pytest.mark.usefixtures('check_xattr_supported')
     def test_get_with_expiry(self, cb_env):
         key, value = cb_env.get_new_doc()
@@ -341,6 +478,42 @@ class CollectionTestSuite:
         # when running local, this can be be up to 1050, so just make sure > 0
         assert expires_in > 0
 
+    def test_handle_kv_ops(self, cb_env):
+        key, value = cb_env.get_new_doc()
+        handle = cb_env.collection.handle()
+        result = handle.insert(key, value, timedelta(seconds=3))
+        assert isinstance(result, MutationResult)
+        assert result.cas != 0
+        result = handle.get(key)
+        assert isinstance(result, GetResult)
+        assert result.key == key
+        assert result.content_as[dict] == value
+        assert handle.exists(key).exists is True
+        new_value = {'id': key}
+        result = handle.replace(key, new_value, cas=result.cas)
+        assert result.cas != 0
+        result = handle.upsert(key, value, timedelta(seconds=3), timedelta(seconds=1000))
+        assert result.cas != 0
+        # the handle and the collection go to the same document
+        assert cb_env.collection.get(key).content_as[dict] == value
+        result = handle.remove(key, timedelta(seconds=3))
+        assert isinstance(result, MutationResult)
+        assert handle.exists(key).exists is False
+
+    def test_handle_kv_ops_fail(self, cb_env):
+        handle = cb_env.collection.handle()
+        with pytest.raises(DocumentNotFoundException):
+            handle.get(TestEnvironment.NOT_A_KEY)
+        with pytest.raises(DocumentNotFoundException):
+            handle.remove(TestEnvironment.NOT_A_KEY)
+        key, value = cb_env.get_existing_doc()
+        with pytest.raises(DocumentExistsException):
+            handle.insert(key, value)
+        with pytest.raises(CasMismatchException):
+            handle.replace(key, value, cas=123)
+        with pytest.raises(InvalidArgumentException):
+            handle.get(key, 10)
+
     def test_insert(self, cb_env):
         key, value = cb_env.get_new_doc()
         result = cb_env.collection.insert(key, value, InsertOptions(
@@ -560,6 +733,18 @@ class CollectionTestSuite:
         assert g_result.key == key
         assert value == g_result.content_as[dict]
 
+    def test_upsert_raw_result(self, cb_env):
+        key, value = cb_env.get_existing_doc()
+        result = cb_env.collection.upsert(key, value)
+        # mutation results keep their fields in slots, raw_result has to provide all of them
+        raw_result = result._orig.raw_result
+        assert raw_result['key'] == key
+        assert raw_result['cas'] == result.cas
+        assert 'mutation_token' in raw_result
+        exists_result = cb_env.collection.exists(key)
+        assert exists_result._orig.raw_result['exists'] is True
+        assert exists_result._orig.raw_result['cas'] == exists_result.cas
+
     @pytest.mark.usefixtures('check_preserve_expiry_supported')
     def test_upsert_preserve_expiry(self, cb_env):
         key, value = cb_env.get_existing_doc()
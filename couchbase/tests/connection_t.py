@@ -291,7 +291,13 @@ class ConnectionTestSuite:
             "config_poll_floor": timedelta(seconds=30),
             "max_http_connections": 10,
             "logging_meter_emit_interval": timedelta(seconds=30),
-            "num_io_threads": 1
+            "num_io_threads": 1,
+            "io_sharding": True,
+            "coalesce_reads": True,
+            "hedge_reads_after": timedelta(milliseconds=20),
+            "stream_high_water_rows": 1000,
+            "stream_high_water_bytes": 1048576,
+            "prepared_statement_cache_size": 500
         }
 
         expected_opts = copy(opts)
@@ -303,6 +309,7 @@ class ConnectionTestSuite:
         expected_opts['tcp_keep_alive_interval'] = 30000000
         expected_opts['config_poll_interval'] = 30000000
         expected_opts['config_poll_floor'] = 30000000
+        expected_opts['hedge_reads_after'] = 20000
         # IpProtocol is translated to string and has another name
         expected_opts.pop('ip_protocol')
         expected_opts['use_ip_protocol'] = 'any'
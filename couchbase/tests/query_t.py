@@ -19,6 +19,8 @@ from datetime import datetime, timedelta
 import pytest
 
 import couchbase.subdocument as SD
+from couchbase.auth import PasswordAuthenticator
+from couchbase.cluster import Cluster
 from couchbase.exceptions import (CouchbaseException,
                                   InvalidArgumentException,
                                   KeyspaceNotFoundException,
@@ -33,7 +35,9 @@ from couchbase.n1ql import (N1QLQuery,
                             QueryScanConsistency,
                             QueryStatus,
                             QueryWarning)
-from couchbase.options import (QueryOptions,
+from couchbase.options import (ClusterOptions,
+                               GetOptions,
+                               QueryOptions,
                                UnsignedInt64,
                                UpsertOptions)
 from couchbase.result import MutationToken
@@ -493,11 +497,16 @@ class QueryTestSuite:
         'test_mixed_named_parameters',
         'test_mixed_positional_parameters',
         'test_preserve_expiry',
+        'test_query_cancel',
         'test_query_error_context',
+        'test_query_fetch_many',
         'test_query_in_thread',
         'test_query_metadata',
+        'test_query_prepared_statement_cache',
         'test_query_raw_options',
+        'test_query_rows_fetch_size',
         'test_query_ryow',
+        'test_query_stream_high_water_kv_ops',
         'test_query_with_metrics',
         'test_query_with_profile',
         'test_simple_query',
@@ -598,6 +607,32 @@ class QueryTestSuite:
         assert len(results) == 1
         assert results[0] is True
 
+    def test_query_cancel(self, cb_env):
+        result = cb_env.cluster.query(f"SELECT * FROM `{cb_env.bucket.name}` LIMIT 5")
+        rows = result.rows()
+        assert isinstance(next(rows), dict)
+        result.cancel()
+        assert list(rows) == []
+        assert result.metadata() is None
+        assert result.fetch_many(5) == []
+        # cancelling twice, or a query that has not been started, is fine
+        result.cancel()
+        cb_env.cluster.query(f"SELECT * FROM `{cb_env.bucket.name}` LIMIT 5").cancel()
+
+    def test_query_fetch_many(self, cb_env):
+        result = cb_env.cluster.query(f"SELECT * FROM `{cb_env.bucket.name}` LIMIT 5")
+        rows = []
+        batch = result.fetch_many(2, timeout=timedelta(seconds=10))
+        while batch:
+            assert len(batch) <= 2
+            rows.extend(batch)
+            batch = result.fetch_many(2)
+
+        assert len(rows) == 5
+        assert all(isinstance(r, dict) for r in rows)
+        assert result.metadata() is not None
+        assert result.metadata().status() == QueryStatus.SUCCESS
+
     def test_query_metadata(self, cb_env):
         result = cb_env.cluster.query(f"SELECT * FROM `{cb_env.bucket.name}` LIMIT 2")
         cb_env.assert_rows(result, 2)
@@ -615,6 +650,55 @@ class QueryTestSuite:
             assert isinstance(warning.message(), str)
             assert isinstance(warning.code(), int)
 
+    # creating a new connection, allow retries
+    @pytest.mark.flaky(reruns=5, reruns_delay=1)
+    def test_query_prepared_statement_cache(self, cb_env):
+        if cb_env.server_version_short < 6.5:
+            pytest.skip(f'Skipped on server versions < 6.5 (using {cb_env.server_version_short}).')
+        conn_string = cb_env.config.get_connection_string()
+        username, pw = cb_env.config.get_username_and_pw()
+        opts = ClusterOptions(PasswordAuthenticator(username, pw), prepared_statement_cache_size=10)
+        cluster = Cluster.connect(conn_string, opts)
+        try:
+            statement = f"SELECT * FROM `{cb_env.bucket.name}` WHERE batch LIKE $1 LIMIT 1"
+            assert cluster.prepare_statements([statement]) == {}
+            failed = cluster.prepare_statements(["I'm not N1QL!"])
+            assert isinstance(failed["I'm not N1QL!"], ParsingFailedException)
+
+            for _ in range(2):
+                result = cluster.query(statement, QueryOptions(adhoc=False,
+                                                               positional_parameters=[f'{cb_env.get_batch_id()}%']))
+                cb_env.assert_rows(result, 1)
+
+            counters = cluster._get_client_connection_info()['prepared_statement_cache']
+            assert counters['capacity'] == 10
+            assert counters['entries'] == 1
+            assert counters['hits'] == 2
+            assert counters['misses'] == 0
+            assert counters['prepares'] == 2
+
+            # concurrent misses on a statement share one PREPARE
+            statement = f"SELECT * FROM `{cb_env.bucket.name}` WHERE batch LIKE $1 LIMIT 2"
+            results = []
+
+            def run_query():
+                result = cluster.query(statement, QueryOptions(adhoc=False,
+                                                               positional_parameters=[f'{cb_env.get_batch_id()}%']))
+                results.append(len(result.rows()))
+
+            threads = [threading.Thread(target=run_query) for _ in range(8)]
+            for t in threads:
+                t.start()
+            for t in threads:
+                t.join()
+            assert results == [2] * 8
+            counters = cluster._get_client_connection_info()['prepared_statement_cache']
+            assert counters['entries'] == 2
+            assert counters['prepares'] == 3
+            assert counters['joined_prepares'] < counters['misses']
+        finally:
+            cluster.close()
+
     def test_query_raw_options(self, cb_env):
         # via raw, we should be able to pass any option
         # if using named params, need to match full name param in query
@@ -629,6 +713,15 @@ class QueryTestSuite:
                                       QueryOptions(raw={'args': [f'{batch_id}%']}))
         cb_env.assert_rows(result, 1)
 
+    def test_query_rows_fetch_size(self, cb_env):
+        result = cb_env.cluster.query(f"SELECT * FROM `{cb_env.bucket.name}` LIMIT 5")
+        rows = [r for r in result.rows(fetch_size=3)]
+        assert len(rows) == 5
+        assert result.metadata() is not None
+
+        with pytest.raises(ValueError):
+            cb_env.cluster.query(f"SELECT * FROM `{cb_env.bucket.name}` LIMIT 1").rows(fetch_size=0)
+
     def test_query_ryow(self, cb_env):
         key, value = cb_env.get_new_doc()
         q_str = f'SELECT * FROM `{cb_env.bucket.name}` USE KEYS "{key}"'
@@ -648,6 +741,33 @@ class QueryTestSuite:
         result = cb_env.cluster.query(q_str, QueryOptions(consistent_with=ms))
         cb_env.assert_rows(result, 1)
 
+    # creating a new connection, allow retries
+    @pytest.mark.flaky(reruns=5, reruns_delay=1)
+    def test_query_stream_high_water_kv_ops(self, cb_env):
+        if cb_env.server_version_short < 6.5:
+            pytest.skip(f'Skipped on server versions < 6.5 (using {cb_env.server_version_short}).')
+        key, value = cb_env.get_new_doc()
+        cb_env.collection.upsert(key, value)
+        conn_string = cb_env.config.get_connection_string()
+        username, pw = cb_env.config.get_username_and_pw()
+        # a single IO thread, reading the stream pauses way before the iterator is done
+        opts = ClusterOptions(PasswordAuthenticator(username, pw), num_io_threads=1, stream_high_water_rows=10)
+        cluster = Cluster.connect(conn_string, opts)
+        try:
+            collection = cluster.bucket(cb_env.bucket.name).default_collection()
+            result = cluster.query('SELECT RAW i FROM ARRAY_RANGE(0, 500) AS i')
+            count = 0
+            for row in result.rows():
+                assert row == count
+                count += 1
+                if count % 50 == 0:
+                    res = collection.get(key, GetOptions(timeout=timedelta(seconds=5)))
+                    assert res.content_as[dict] == value
+            assert count == 500
+            assert result.metadata() is not None
+        finally:
+            cluster.close()
+
     def test_query_with_metrics(self, cb_env):
         initial = datetime.now()
         result = cb_env.cluster.query(
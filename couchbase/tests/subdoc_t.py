@@ -50,12 +50,14 @@ class SubDocumentTestSuite:
         'test_array_prepend',
         'test_array_prepend_create_parents',
         'test_array_prepend_multi_insert',
+        'test_compiled_spec_invalid',
         'test_count',
         'test_decrement',
         'test_decrement_create_parents',
         'test_increment',
         'test_increment_create_parents',
         'test_insert_create_parents',
+        'test_lookup_in_compiled_spec',
         'test_lookup_in_multiple_specs',
         'test_lookup_in_one_path_not_found',
         'test_lookup_in_simple_exists',
@@ -63,6 +65,7 @@ class SubDocumentTestSuite:
         'test_lookup_in_simple_get',
         'test_lookup_in_simple_get_spec_as_list',
         'test_lookup_in_simple_long_path',
+        'test_mutate_in_compiled_spec',
         'test_mutate_in_expiry',
         'test_mutate_in_insert_semantics',
         'test_mutate_in_insert_semantics_fail',
@@ -254,6 +257,18 @@ class SubDocumentTestSuite:
         assert len(pre_res) == 3
         assert pre_res == [-2, -1, 0]
 
+    def test_compiled_spec_invalid(self, cb_env):
+        with pytest.raises(InvalidArgumentException):
+            SD.CompiledSpec([])
+        with pytest.raises(InvalidArgumentException):
+            SD.CompiledSpec([SD.get('batch'), SD.upsert('batch', 'value')])
+        spec = SD.CompiledSpec([SD.upsert('batch', 'value'), SD.remove('make')])
+        with pytest.raises(InvalidArgumentException):
+            spec.bind('value', 'other value')
+        key = cb_env.get_existing_doc_by_type('vehicle', key_only=True)
+        with pytest.raises(InvalidArgumentException):
+            cb_env.collection.lookup_in(key, spec)
+
     def test_count(self, cb_env):
         key = cb_env.get_existing_doc_by_type('array', key_only=True)
         result = cb_env.collection.lookup_in(key, (SD.count('array'),))
@@ -303,6 +318,19 @@ class SubDocumentTestSuite:
         assert result.content_as[dict]['new']['path'] == 'parents created'
 
     @pytest.mark.usefixtures("check_xattr_supported")
+    def test_lookup_in_compiled_spec(self, cb_env):
+        key, value = cb_env.get_existing_doc_by_type('vehicle')
+        spec = SD.CompiledSpec([SD.get('batch'), SD.exists('manufacturer.geo.location.tz'), SD.exists('qzx')])
+        assert spec.is_mutation is False
+        assert len(spec) == 3
+        # the same compiled spec is reused across calls
+        for _ in range(3):
+            result = cb_env.collection.lookup_in(key, spec)
+            assert isinstance(result, LookupInResult)
+            assert result.content_as[str](0) == value['batch']
+            assert result.exists(1) is True
+            assert result.exists(2) is False
+
     def test_lookup_in_multiple_specs(self, cb_env):
         key, value = cb_env.get_existing_doc_by_type('vehicle')
         result = cb_env.collection.lookup_in(key, (SD.get('$document.exptime', xattr=True),
@@ -364,6 +392,22 @@ class SubDocumentTestSuite:
         assert isinstance(result, LookupInResult)
         assert result.content_as[str](0) == value['manufacturer']['geo']['location']['tz']
 
+    def test_mutate_in_compiled_spec(self, cb_env):
+        key, value = cb_env.get_existing_doc_by_type('vehicle')
+        spec = SD.CompiledSpec([SD.upsert('make', 'New Make'), SD.replace('model', 'New Model')])
+        assert spec.is_mutation is True
+        result = cb_env.collection.mutate_in(key, spec)
+        assert isinstance(result, MutateInResult)
+        result = cb_env.collection.get(key)
+        assert result.content_as[dict]['make'] == 'New Make'
+        assert result.content_as[dict]['model'] == 'New Model'
+
+        result = cb_env.collection.mutate_in(key, spec.bind('Bound Make', 'Bound Model'))
+        assert isinstance(result, MutateInResult)
+        result = cb_env.collection.get(key)
+        assert result.content_as[dict]['make'] == 'Bound Make'
+        assert result.content_as[dict]['model'] == 'Bound Model'
+
     @pytest.mark.usefixtures("check_xattr_supported")
     @pytest.mark.usefixtures('skip_if_go_caves')
     def test_mutate_in_expiry(self, cb_env):
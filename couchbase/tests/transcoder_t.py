@@ -25,8 +25,10 @@ from couchbase.options import (GetAndLockOptions,
                                GetAndTouchOptions,
                                GetOptions,
                                ReplaceOptions)
+from couchbase.serializer import DefaultJsonSerializer
 from couchbase.transcoder import (JSONTranscoder,
                                   LegacyTranscoder,
+                                  NativeJSONTranscoder,
                                   RawBinaryTranscoder,
                                   RawJSONTranscoder,
                                   RawStringTranscoder)
@@ -130,6 +132,7 @@ class DefaultTranscoderTestSuite:
 class KeyValueOpTranscoderTestSuite:
     TEST_MANIFEST = [
         'test_get',
+        'test_get_custom_serializer',
         'test_get_and_lock',
         'test_get_and_touch',
         'test_insert',
@@ -146,6 +149,21 @@ class KeyValueOpTranscoderTestSuite:
         assert isinstance(res.value, bytes)
         assert res.content_as[bytes] == value
 
+    def test_get_custom_serializer(self, cb_env):
+        class TaggingSerializer(DefaultJsonSerializer):
+            def deserialize(self, value):
+                return {'tagged': True, 'doc': super().deserialize(value)}
+
+        key, value = cb_env.get_existing_doc_by_type('json')
+        # a customized serializer must not be bypassed by the native JSON decoding
+        tc = JSONTranscoder(TaggingSerializer())
+        assert tc.native_json_decode is False
+        res = cb_env.collection.get(key, GetOptions(transcoder=tc))
+        assert res.content_as[dict] == {'tagged': True, 'doc': value}
+        assert JSONTranscoder().native_json_decode is True
+        res = cb_env.collection.get(key)
+        assert res.content_as[dict] == value
+
     def test_get_and_touch(self, cb_env):
         key, value = cb_env.get_existing_doc_by_type('bytes')
         tc = RawBinaryTranscoder()
@@ -318,6 +336,7 @@ class LegacyTranscoderTestSuite:
 
 class RawBinaryTranscoderTestSuite:
     TEST_MANIFEST = [
+        'test_raw_binary_tc_buffer_upsert',
         'test_raw_binary_tc_bytes_insert',
         'test_raw_binary_tc_bytes_replace',
         'test_raw_binary_tc_bytes_upsert',
@@ -330,8 +349,17 @@ class RawBinaryTranscoderTestSuite:
         'test_raw_binary_tc_string_insert',
         'test_raw_binary_tc_string_replace',
         'test_raw_binary_tc_string_upsert',
+        'test_raw_binary_tc_zero_copy_get',
     ]
 
+    def test_raw_binary_tc_buffer_upsert(self, cb_env):
+        key, value = cb_env.get_new_doc_by_type('bytes')
+        for buf in [bytearray(value), memoryview(value)]:
+            cb_env.collection.upsert(key, buf)
+            res = cb_env.collection.get(key)
+            assert isinstance(res.value, bytes)
+            assert value == res.content_as[bytes]
+
     def test_raw_binary_tc_bytes_insert(self, cb_env):
         key, value = cb_env.get_new_doc_by_type('bytes')
         cb_env.collection.insert(key, value)
@@ -409,6 +437,14 @@ class RawBinaryTranscoderTestSuite:
         with pytest.raises(ValueFormatException):
             cb_env.collection.replace(key, value)
 
+    def test_raw_binary_tc_zero_copy_get(self, cb_env):
+        key, value = cb_env.get_new_doc_by_type('bytes')
+        cb_env.collection.upsert(key, value)
+        res = cb_env.collection.get(key, GetOptions(transcoder=RawBinaryTranscoder(zero_copy=True)))
+        assert isinstance(res.value, memoryview)
+        assert res.value.readonly is True
+        assert value == bytes(res.value)
+
 
 class RawJsonTranscoderTestSuite:
     TEST_MANIFEST = [
@@ -587,6 +623,31 @@ class ClassicDefaultTranscoderTests(DefaultTranscoderTestSuite):
         cb_env.teardown(request.param)
 
 
+class ClassicNativeJsonTranscoderTests(DefaultTranscoderTestSuite):
+
+    @pytest.fixture(scope='class')
+    def test_manifest_validated(self):
+        def valid_test_method(meth):
+            attr = getattr(ClassicNativeJsonTranscoderTests, meth)
+            return callable(attr) and not meth.startswith('__') and meth.startswith('test')
+        method_list = [meth for meth in dir(ClassicNativeJsonTranscoderTests) if valid_test_method(meth)]
+        compare = set(DefaultTranscoderTestSuite.TEST_MANIFEST).difference(method_list)
+        return compare
+
+    @pytest.fixture(scope='class', name='cb_env', params=[CollectionType.DEFAULT, CollectionType.NAMED])
+    def couchbase_test_environment(self, cb_base_env, test_manifest_validated, request):
+        if test_manifest_validated:
+            pytest.fail(f'Test manifest not validated.  Missing tests: {test_manifest_validated}.')
+
+        cb_env = TranscoderTestEnvironment.from_environment(cb_base_env)
+        cb_env.setup(request.param)
+        cb_env.cluster.default_transcoder = NativeJSONTranscoder()
+        yield cb_env
+        cb_env.teardown(request.param)
+        # reset the transcoder
+        cb_env.cluster.default_transcoder = JSONTranscoder()
+
+
 class KeyValueOpTranscoderTests(KeyValueOpTranscoderTestSuite):
 
     @pytest.fixture(scope='class')
@@ -16,10 +16,12 @@
 from __future__ import annotations
 
 import json
+import mmap
 import pickle  # nosec
 from abc import ABC, abstractmethod
 from typing import (TYPE_CHECKING,
                     Any,
+                    Optional,
                     Tuple,
                     Union)
 
@@ -30,7 +32,7 @@ from couchbase.constants import (FMT_BYTES,
                                  FMT_PICKLE,
                                  FMT_UTF8)
 from couchbase.exceptions import InvalidArgumentException, ValueFormatException
-from couchbase.serializer import DefaultJsonSerializer
+from couchbase.serializer import DefaultJsonSerializer, NativeJsonSerializer
 
 if TYPE_CHECKING:
     from couchbase.serializer import Serializer
@@ -97,6 +99,16 @@ class JSONTranscoder(Transcoder):
         else:
             self._serializer = serializer
 
+    @property
+    def native_json_decode(self) -> bool:
+        """
+            **INTERNAL**
+            Whether JSON documents can be parsed by the C++ core (off the GIL) instead of calling
+            :meth:`decode_value`.  Only true when neither the decoding nor the serializer is customized.
+        """
+        return (type(self).decode_value is JSONTranscoder.decode_value
+                and type(self._serializer) in (DefaultJsonSerializer, NativeJsonSerializer))
+
     def encode_value(self,
                      value,  # type: Any
                      ) -> Tuple[bytes, int]:
@@ -137,6 +149,16 @@ class JSONTranscoder(Transcoder):
                 "Unrecognized format provided: {}".format(format))
 
 
+class NativeJSONTranscoder(JSONTranscoder):
+    """A :class:`.JSONTranscoder` that uses the :class:`~couchbase.serializer.NativeJsonSerializer`.
+
+    Set as the default transcoder with ``ClusterOptions(transcoder=NativeJSONTranscoder())``.
+    """
+
+    def __init__(self):
+        super().__init__(NativeJsonSerializer())
+
+
 class RawJSONTranscoder(Transcoder):
 
     def encode_value(self,
@@ -212,22 +234,42 @@ class RawStringTranscoder(Transcoder):
 
 
 class RawBinaryTranscoder(Transcoder):
+    """Transcoder for binary documents.
+
+    Any buffer (``bytes``, ``bytearray``, ``memoryview``, ``mmap``, ...) can be stored, it is read in place
+    instead of first being copied into a ``bytes`` object.
+
+    Args:
+        zero_copy (bool, optional): If True, documents are returned as a read-only ``memoryview`` over the
+            buffer received from the server instead of being copied into ``bytes``.  Defaults to False.
+    """
+
+    def __init__(self, zero_copy=False  # type: Optional[bool]
+                 ):
+        self._zero_copy = zero_copy is True
+
+    @property
+    def zero_copy_decode(self) -> bool:
+        """
+            **INTERNAL**
+            Whether :meth:`decode_value` should be handed a read-only memoryview over the document instead of bytes.
+        """
+        return self._zero_copy
+
     def encode_value(self,
-                     value  # type: Union[bytes,bytearray]
-                     ) -> Tuple[bytes, int]:
+                     value  # type: Union[bytes,bytearray,memoryview,mmap.mmap]
+                     ) -> Tuple[Union[bytes, bytearray, memoryview, mmap.mmap], int]:
 
-        if isinstance(value, (bytes, bytearray)):
-            if isinstance(value, bytearray):
-                value = bytes(value)
+        if isinstance(value, (bytes, bytearray, memoryview, mmap.mmap)):
             return value, FMT_BYTES
         else:
             raise ValueFormatException(
                 "Only binary data supported by RawBinaryTranscoder")
 
     def decode_value(self,
-                     value,  # type: bytes
+                     value,  # type: Union[bytes,memoryview]
                      flags  # type: int
-                     ) -> bytes:
+                     ) -> Union[bytes, memoryview]:
 
         format = get_decode_format(flags)
 
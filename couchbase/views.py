@@ -64,7 +64,7 @@ class ViewRequest(ViewRequestLogic):
 
     def _get_next_row(self):
         if self.done_streaming is True:
-            return
+            raise StopIteration
 
         row = next(self._streaming_result)
         if isinstance(row, CouchbaseBaseException):
@@ -85,6 +85,9 @@ class ViewRequest(ViewRequestLogic):
         try:
             return self._get_next_row()
         except StopIteration:
+            # already done, metadata has been fetched
+            if self.done_streaming:
+                raise
             self._done_streaming = True
             self._get_metadata()
             raise
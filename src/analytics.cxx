@@ -20,6 +20,8 @@
 #include "result.hxx"
 #include "tracing.hxx"
 #include <core/analytics_scan_consistency.hxx>
+#include <memory>
+#include <string>
 
 couchbase::core::analytics_scan_consistency
 str_to_scan_consistency_type(std::string consistency)
@@ -301,8 +303,9 @@ create_analytics_result(couchbase::core::operations::analytics_response resp,
     } else {
         for (auto const& row : resp.rows) {
             PyObject* pyObj_row = PyBytes_FromStringAndSize(row.c_str(), row.length());
-            rows->put(pyObj_row);
+            rows->stage(pyObj_row);
         }
+        rows->publish();
 
         auto res = create_result_from_analytics_response(resp, include_metrics);
         if (res == nullptr || PyErr_Occurred() != nullptr) {
@@ -532,22 +535,23 @@ handle_analytics_query([[maybe_unused]] PyObject* self, PyObject* args, PyObject
     // timeout is always set either to default, or timeout provided in options
     streamed_result* streamed_res = create_streamed_result_obj(req.timeout.value());
 
-    // TODO:  let the couchbase++ streaming stabilize a bit more...
-    // req.row_callback = [rows = streamed_res->rows](std::string&& row) {
-    //     PyGILState_STATE state = PyGILState_Ensure();
-    //     PyObject* pyObj_row = PyBytes_FromStringAndSize(row.c_str(), row.length());
-    //     rows->put(pyObj_row);
-    //     PyGILState_Release(state);
-    //     return couchbase::core::utils::json::stream_control::next_row;
-    // };
+    // same as for queries, rows reach the iterator as they are parsed and the response (metadata only) follows them
+    // through the dispatcher
+    auto stream = std::make_shared<row_stream>(conn, streamed_res->rows, conn->stream_high_water_rows_, conn->stream_high_water_bytes_);
+    streamed_res->stream = stream;
+    req.row_callback = [stream](std::string&& row) {
+        return stream->on_row(std::move(row)) ? couchbase::core::utils::json::stream_control::next_row
+                                              : couchbase::core::utils::json::stream_control::stop;
+    };
 
     {
-        Py_BEGIN_ALLOW_THREADS conn->cluster_->execute(
+        Py_BEGIN_ALLOW_THREADS conn->stream_cluster()->execute(
           req,
-          [rows = streamed_res->rows, include_metrics = metrics, pyObj_callback, pyObj_errback](
-            couchbase::core::operations::analytics_response resp) {
-              create_analytics_result(resp, include_metrics, rows, pyObj_callback, pyObj_errback);
-          });
+          conn->defer<couchbase::core::operations::analytics_response>(
+            [rows = streamed_res->rows, include_metrics = metrics, pyObj_callback, pyObj_errback](
+              couchbase::core::operations::analytics_response resp) {
+                create_analytics_result(std::move(resp), include_metrics, rows, pyObj_callback, pyObj_errback);
+            }));
         Py_END_ALLOW_THREADS
     }
     return streamed_res;
@@ -0,0 +1,396 @@
+/*
+ *   Copyright 2016-2022. Couchbase, Inc.
+ *   All Rights Reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include "async_completions.hxx"
+#include "result.hxx"
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+#endif
+
+namespace
+{
+PyObject* pyObj_done_str = nullptr;
+PyObject* pyObj_set_result_str = nullptr;
+PyObject* pyObj_set_exception_str = nullptr;
+
+// returns false w/ errno set on failure, there is nothing the loop can watch on Windows
+bool
+open_wakeup_fds([[maybe_unused]] int& read_fd, [[maybe_unused]] int& write_fd)
+{
+#if defined(_WIN32)
+    return false;
+#elif defined(__linux__)
+    int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    read_fd = fd;
+    write_fd = fd;
+    return true;
+#else
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return false;
+    }
+    for (int fd : fds) {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+    read_fd = fds[0];
+    write_fd = fds[1];
+    return true;
+#endif
+}
+
+void
+release_entry(async_completions::entry& e)
+{
+    Py_XDECREF(e.future);
+    Py_XDECREF(e.converter);
+    Py_XDECREF(e.context);
+    Py_XDECREF(e.value);
+}
+} // namespace
+
+async_completions::~async_completions()
+{
+    // normally drained by the loop, whatever is left belongs to a loop that is gone
+    if (!pending_.empty() && Py_IsInitialized()) {
+        PyGILState_STATE state = PyGILState_Ensure();
+        for (auto& e : pending_) {
+            release_entry(e);
+        }
+        PyGILState_Release(state);
+    }
+#ifndef _WIN32
+    close(read_fd_);
+    if (write_fd_ != read_fd_) {
+        close(write_fd_);
+    }
+#endif
+}
+
+void
+async_completions::push(entry e)
+{
+    bool wake = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back(e);
+        wake = !signalled_;
+        signalled_ = true;
+    }
+    if (wake) {
+        signal();
+    }
+}
+
+std::vector<async_completions::entry>
+async_completions::take()
+{
+    std::vector<entry> entries{};
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (signalled_) {
+        clear_signal();
+        signalled_ = false;
+    }
+    entries.swap(pending_);
+    return entries;
+}
+
+void
+async_completions::signal()
+{
+#if defined(_WIN32)
+#elif defined(__linux__)
+    std::uint64_t one = 1;
+    // EAGAIN only means the counter is saturated, the loop is woken either way
+    [[maybe_unused]] auto written = write(write_fd_, &one, sizeof(one));
+#else
+    char one = 1;
+    [[maybe_unused]] auto written = write(write_fd_, &one, sizeof(one));
+#endif
+}
+
+void
+async_completions::clear_signal()
+{
+#if defined(_WIN32)
+#elif defined(__linux__)
+    std::uint64_t count = 0;
+    [[maybe_unused]] auto nread = read(read_fd_, &count, sizeof(count));
+#else
+    char buf[64];
+    while (read(read_fd_, buf, sizeof(buf)) > 0) {
+    }
+#endif
+}
+
+/**
+ * Resolve the future of a drained entry (w/ the GIL held), futures that were cancelled in the meantime are
+ * skipped.  Failures of the converter or error_mapper are set on the future instead.
+ */
+static void
+resolve_future(PyObject* pyObj_error_mapper, async_completions::entry& e)
+{
+    PyObject* pyObj_done = PyObject_CallMethodObjArgs(e.future, pyObj_done_str, nullptr);
+    if (pyObj_done == nullptr) {
+        PyErr_Print();
+        return;
+    }
+    auto done = PyObject_IsTrue(pyObj_done) == 1;
+    Py_DECREF(pyObj_done);
+    if (done) {
+        return;
+    }
+
+    PyObject* pyObj_method = e.is_error ? pyObj_set_exception_str : pyObj_set_result_str;
+    PyObject* pyObj_value = nullptr;
+    if (e.is_error) {
+        pyObj_value = PyObject_CallFunctionObjArgs(pyObj_error_mapper, e.value, nullptr);
+    } else if (e.converter != nullptr) {
+        pyObj_value = PyObject_CallFunctionObjArgs(e.converter, e.value != nullptr ? e.value : Py_None, e.context, nullptr);
+    } else {
+        pyObj_value = e.value != nullptr ? e.value : Py_None;
+        Py_INCREF(pyObj_value);
+    }
+    if (pyObj_value == nullptr) {
+        PyObject *pyObj_type = nullptr, *pyObj_traceback = nullptr;
+        PyErr_Fetch(&pyObj_type, &pyObj_value, &pyObj_traceback);
+        PyErr_NormalizeException(&pyObj_type, &pyObj_value, &pyObj_traceback);
+        if (pyObj_traceback != nullptr) {
+            PyException_SetTraceback(pyObj_value, pyObj_traceback);
+        }
+        Py_XDECREF(pyObj_type);
+        Py_XDECREF(pyObj_traceback);
+        pyObj_method = pyObj_set_exception_str;
+    }
+    PyObject* pyObj_res = PyObject_CallMethodObjArgs(e.future, pyObj_method, pyObj_value, nullptr);
+    if (pyObj_res == nullptr) {
+        PyErr_Print();
+    }
+    Py_XDECREF(pyObj_res);
+    Py_XDECREF(pyObj_value);
+}
+
+PyTypeObject async_completions_type = { PyObject_HEAD_INIT(NULL) 0 };
+PyTypeObject async_completion_type = { PyObject_HEAD_INIT(NULL) 0 };
+
+static PyObject*
+async_completions_new(PyTypeObject* type, PyObject* args, PyObject* kwargs)
+{
+    PyObject* pyObj_error_mapper = nullptr;
+    static const char* kw_list[] = { "error_mapper", nullptr };
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O", const_cast<char**>(kw_list), &pyObj_error_mapper)) {
+        return nullptr;
+    }
+#ifdef _WIN32
+    PyErr_SetString(PyExc_NotImplementedError, "async_completions needs a file descriptor the event loop can watch.");
+    return nullptr;
+#endif
+    int read_fd = -1;
+    int write_fd = -1;
+    if (!open_wakeup_fds(read_fd, write_fd)) {
+        return PyErr_SetFromErrno(PyExc_OSError);
+    }
+
+    auto* self = reinterpret_cast<async_completions_queue*>(type->tp_alloc(type, 0));
+    if (self == nullptr) {
+        return nullptr;
+    }
+    new (&self->queue) std::shared_ptr<async_completions>{ std::make_shared<async_completions>(read_fd, write_fd) };
+    Py_INCREF(pyObj_error_mapper);
+    self->error_mapper = pyObj_error_mapper;
+    return reinterpret_cast<PyObject*>(self);
+}
+
+static void
+async_completions_dealloc(async_completions_queue* self)
+{
+    for (auto& e : self->queue->take()) {
+        release_entry(e);
+    }
+    std::destroy_at(&self->queue);
+    Py_XDECREF(self->error_mapper);
+    Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
+}
+
+static PyObject*
+async_completions__fileno__(async_completions_queue* self, [[maybe_unused]] PyObject* args)
+{
+    return PyLong_FromLong(self->queue->fileno());
+}
+
+static PyObject*
+async_completions__drain__(async_completions_queue* self, [[maybe_unused]] PyObject* args)
+{
+    auto entries = self->queue->take();
+    for (auto& e : entries) {
+        resolve_future(self->error_mapper, e);
+        release_entry(e);
+    }
+    return PyLong_FromSize_t(entries.size());
+}
+
+// completion(future, converter=None, context=None)
+static PyObject*
+async_completions__completion__(async_completions_queue* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (nargs < 1 || nargs > 3) {
+        PyErr_SetString(PyExc_TypeError, "completion() takes a future and an optional converter and context.");
+        return nullptr;
+    }
+    auto* completion = reinterpret_cast<async_completion*>(async_completion_type.tp_alloc(&async_completion_type, 0));
+    if (completion == nullptr) {
+        return nullptr;
+    }
+    new (&completion->queue) std::shared_ptr<async_completions>{ self->queue };
+    completion->future = args[0];
+    completion->converter = nargs > 1 && args[1] != Py_None ? args[1] : nullptr;
+    completion->context = nargs > 2 && args[2] != Py_None ? args[2] : nullptr;
+    Py_INCREF(completion->future);
+    Py_XINCREF(completion->converter);
+    Py_XINCREF(completion->context);
+    return reinterpret_cast<PyObject*>(completion);
+}
+
+/**
+ * watch_rows(streamed_result, future): resolve future w/ None once the stream has a row to hand out, so the
+ * next next() call does not block the loop.  Returns False, w/o touching the future, if a row is available
+ * already.
+ */
+static PyObject*
+async_completions__watch_rows__(async_completions_queue* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    if (nargs != 2 || !PyObject_TypeCheck(args[0], &streamed_result_type)) {
+        PyErr_SetString(PyExc_TypeError, "watch_rows() takes a streamed_result and a future.");
+        return nullptr;
+    }
+    auto* stream = reinterpret_cast<streamed_result*>(args[0]);
+    PyObject* pyObj_future = args[1];
+    Py_INCREF(pyObj_future);
+    auto armed = stream->rows->notify_once([queue = self->queue, pyObj_future]() {
+        async_completions::entry e{};
+        e.future = pyObj_future;
+        queue->push(e);
+    });
+    if (!armed) {
+        Py_DECREF(pyObj_future);
+        Py_RETURN_FALSE;
+    }
+    Py_RETURN_TRUE;
+}
+
+static PyMethodDef async_completions_methods[] = {
+    { "fileno", (PyCFunction)async_completions__fileno__, METH_NOARGS, PyDoc_STR("Descriptor the event loop watches for completions") },
+    { "drain", (PyCFunction)async_completions__drain__, METH_NOARGS, PyDoc_STR("Resolve the futures of all queued completions") },
+    { "completion",
+      (PyCFunction)(void (*)(void))async_completions__completion__,
+      METH_FASTCALL,
+      PyDoc_STR("Callback/errback resolving future, completion(future, converter=None, context=None)") },
+    { "watch_rows",
+      (PyCFunction)(void (*)(void))async_completions__watch_rows__,
+      METH_FASTCALL,
+      PyDoc_STR("Resolve future once a streamed_result has a row, False if it has one already") },
+    { NULL, NULL, 0, NULL }
+};
+
+static PyObject*
+async_completion_call(async_completion* self, PyObject* args, [[maybe_unused]] PyObject* kwargs)
+{
+    // only the first call of either the callback or the errback counts
+    if (!self->queue || PyTuple_GET_SIZE(args) < 1) {
+        Py_RETURN_NONE;
+    }
+    PyObject* pyObj_value = PyTuple_GET_ITEM(args, 0);
+    Py_INCREF(pyObj_value);
+    async_completions::entry e{};
+    e.future = std::exchange(self->future, nullptr);
+    e.converter = std::exchange(self->converter, nullptr);
+    e.context = std::exchange(self->context, nullptr);
+    e.value = pyObj_value;
+    e.is_error = PyObject_TypeCheck(pyObj_value, &exception_base_type);
+    auto queue = std::move(self->queue);
+    queue->push(e);
+    Py_RETURN_NONE;
+}
+
+static void
+async_completion_dealloc(async_completion* self)
+{
+    Py_XDECREF(self->future);
+    Py_XDECREF(self->converter);
+    Py_XDECREF(self->context);
+    std::destroy_at(&self->queue);
+    Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
+}
+
+int
+pycbc_async_completions_type_init(PyObject** ptr)
+{
+    PyTypeObject* p = &async_completions_type;
+
+    *ptr = (PyObject*)p;
+    if (p->tp_name) {
+        return 0;
+    }
+
+    pyObj_done_str = PyUnicode_InternFromString("done");
+    pyObj_set_result_str = PyUnicode_InternFromString("set_result");
+    pyObj_set_exception_str = PyUnicode_InternFromString("set_exception");
+    if (pyObj_done_str == nullptr || pyObj_set_result_str == nullptr || pyObj_set_exception_str == nullptr) {
+        return -1;
+    }
+
+    p->tp_name = "pycbc_core.async_completions";
+    p->tp_doc = "Completions of asyncio operations, drained by the event loop";
+    p->tp_basicsize = sizeof(async_completions_queue);
+    p->tp_flags = Py_TPFLAGS_DEFAULT;
+    p->tp_new = async_completions_new;
+    p->tp_dealloc = (destructor)async_completions_dealloc;
+    p->tp_methods = async_completions_methods;
+
+    return PyType_Ready(p);
+}
+
+int
+pycbc_async_completion_type_init(PyObject** ptr)
+{
+    PyTypeObject* p = &async_completion_type;
+
+    *ptr = (PyObject*)p;
+    if (p->tp_name) {
+        return 0;
+    }
+
+    p->tp_name = "pycbc_core.async_completion";
+    p->tp_doc = "Callback and errback of a single asyncio operation";
+    p->tp_basicsize = sizeof(async_completion);
+    p->tp_flags = Py_TPFLAGS_DEFAULT;
+    p->tp_dealloc = (destructor)async_completion_dealloc;
+    p->tp_call = (ternaryfunc)async_completion_call;
+
+    return PyType_Ready(p);
+}
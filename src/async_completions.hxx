@@ -0,0 +1,103 @@
+/*
+ *   Copyright 2016-2022. Couchbase, Inc.
+ *   All Rights Reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#pragma once
+
+#include "client.hxx"
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * Completions of asyncio operations, handed to the event loop in bulk.
+ *
+ * An async_completion is passed as both callback and errback of an operation, once the dispatcher calls it
+ * the outcome is queued here and the loop is woken through a file descriptor it watches w/ add_reader().  The
+ * descriptor is only written when the queue goes from empty to non-empty, so the loop resolves every queued
+ * future in a single drain() call instead of running one call_soon_threadsafe() callback per operation.
+ */
+class async_completions
+{
+  public:
+    struct entry {
+        PyObject* future{ nullptr };
+        PyObject* converter{ nullptr };
+        PyObject* context{ nullptr };
+        // result or exception of the operation, nullptr for a rows watch (the future is resolved w/ None)
+        PyObject* value{ nullptr };
+        bool is_error{ false };
+    };
+
+    async_completions(int read_fd, int write_fd)
+      : read_fd_{ read_fd }
+      , write_fd_{ write_fd }
+    {
+    }
+
+    async_completions(const async_completions&) = delete;
+    async_completions& operator=(const async_completions&) = delete;
+
+    ~async_completions();
+
+    // the entry's references are owned by the queue from here on, safe to call w/o the GIL
+    void push(entry e);
+
+    // the queued entries, oldest first, and re-arms the wake up
+    std::vector<entry> take();
+
+    int fileno() const
+    {
+        return read_fd_;
+    }
+
+  private:
+    void signal();
+    void clear_signal();
+
+    std::mutex mutex_;
+    std::vector<entry> pending_{};
+    bool signalled_{ false };
+    int read_fd_;
+    int write_fd_;
+};
+
+/**
+ * pycbc_core.async_completions(error_mapper): one per event loop.  error_mapper turns the pycbc_core exception
+ * an operation failed w/ into the exception set on its future.
+ */
+struct async_completions_queue {
+    PyObject_HEAD std::shared_ptr<async_completions> queue;
+    PyObject* error_mapper;
+};
+
+/**
+ * pycbc_core.async_completion: callback and errback of a single operation, created by
+ * async_completions.completion(future, converter=None, context=None).  On success the future is resolved w/
+ * converter(result[, context]), or the result itself if there is no converter.
+ */
+struct async_completion {
+    PyObject_HEAD std::shared_ptr<async_completions> queue;
+    PyObject* future;
+    PyObject* converter;
+    PyObject* context;
+};
+
+int
+pycbc_async_completions_type_init(PyObject** ptr);
+
+int
+pycbc_async_completion_type_init(PyObject** ptr);
@@ -100,15 +100,7 @@ create_result_from_binary_op_response(const char* key,
         pyObj_exc = build_exception_from_context(resp.ctx, __FILE__, __LINE__, "Binary operation error.");
         if (pyObj_errback == nullptr) {
             if (multi_result != nullptr) {
-                Py_INCREF(Py_False);
-                barrier->set_value(Py_False);
-                if (-1 == PyDict_SetItemString(multi_result->dict, key, pyObj_exc)) {
-                    // TODO:  not much we can do here...maybe?
-                    PyErr_Print();
-                    PyErr_Clear();
-                }
-                // won't fall into logic path where pyObj_exc is decremented later
-                Py_DECREF(pyObj_exc);
+                add_multi_op_result(multi_result, key, pyObj_exc, false, barrier);
             } else {
                 barrier->set_value(pyObj_exc);
             }
@@ -131,14 +123,7 @@ create_result_from_binary_op_response(const char* key,
         } else {
             if (pyObj_callback == nullptr) {
                 if (multi_result != nullptr) {
-                    Py_INCREF(Py_True);
-                    barrier->set_value(Py_True);
-                    if (-1 == PyDict_SetItemString(multi_result->dict, key, reinterpret_cast<PyObject*>(res))) {
-                        // TODO:  not much we can do here...maybe?
-                        PyErr_Print();
-                        PyErr_Clear();
-                    }
-                    Py_DECREF(reinterpret_cast<PyObject*>(res));
+                    add_multi_op_result(multi_result, key, reinterpret_cast<PyObject*>(res), true, barrier);
                 } else {
                     barrier->set_value(reinterpret_cast<PyObject*>(res));
                 }
@@ -154,15 +139,7 @@ create_result_from_binary_op_response(const char* key,
         pyObj_exc = pycbc_build_exception(PycbcError::UnableToBuildResult, __FILE__, __LINE__, "Binary operation error.");
         if (pyObj_errback == nullptr) {
             if (multi_result != nullptr) {
-                Py_INCREF(Py_False);
-                barrier->set_value(Py_False);
-                if (-1 == PyDict_SetItemString(multi_result->dict, key, pyObj_exc)) {
-                    // TODO:  not much we can do here...maybe?
-                    PyErr_Print();
-                    PyErr_Clear();
-                }
-                // won't fall into logic path where pyObj_exc is decremented later
-                Py_DECREF(pyObj_exc);
+                add_multi_op_result(multi_result, key, pyObj_exc, false, barrier);
             } else {
                 barrier->set_value(pyObj_exc);
             }
@@ -192,17 +169,17 @@ create_result_from_binary_op_response(const char* key,
 template<typename Request>
 void
 do_binary_op(connection& conn,
-             Request& req,
+             Request req,
              PyObject* pyObj_callback,
              PyObject* pyObj_errback,
              std::shared_ptr<std::promise<PyObject*>> barrier,
              result* multi_result = nullptr)
 {
     using response_type = typename Request::response_type;
-    Py_BEGIN_ALLOW_THREADS conn.cluster_->execute(
-      req, [key = req.id.key(), pyObj_callback, pyObj_errback, barrier, multi_result](response_type resp) {
-          create_result_from_binary_op_response(key.c_str(), resp, pyObj_callback, pyObj_errback, barrier, multi_result);
-      });
+    auto handler = [key = req.id.key(), pyObj_callback, pyObj_errback, barrier, multi_result](response_type resp) {
+        create_result_from_binary_op_response(key.c_str(), resp, pyObj_callback, pyObj_errback, barrier, multi_result);
+    };
+    Py_BEGIN_ALLOW_THREADS conn.execute_mutation(std::move(req), std::move(handler));
     Py_END_ALLOW_THREADS
 }
 
@@ -226,12 +203,14 @@ prepare_and_execute_counter_op(struct counter_options* options,
         }
         if (options->use_legacy_durability) {
             auto req_legacy_durability =
-              couchbase::core::operations::increment_request_with_legacy_durability{ req, options->persist_to, options->replicate_to };
-            do_binary_op(*(options->conn), req_legacy_durability, pyObj_callback, pyObj_errback, barrier, multi_result);
+              couchbase::core::operations::increment_request_with_legacy_durability{
+                std::move(req), options->persist_to, options->replicate_to
+              };
+            do_binary_op(*(options->conn), std::move(req_legacy_durability), pyObj_callback, pyObj_errback, barrier, multi_result);
             Py_RETURN_NONE;
         }
         req.durability_level = options->durability_level;
-        do_binary_op(*(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result);
+        do_binary_op(*(options->conn), std::move(req), pyObj_callback, pyObj_errback, barrier, multi_result);
     } else {
         auto req = couchbase::core::operations::decrement_request{ options->id };
         req.timeout = options->timeout_ms;
@@ -245,12 +224,14 @@ prepare_and_execute_counter_op(struct counter_options* options,
         }
         if (options->use_legacy_durability) {
             auto req_legacy_durability =
-              couchbase::core::operations::decrement_request_with_legacy_durability{ req, options->persist_to, options->replicate_to };
-            do_binary_op(*(options->conn), req_legacy_durability, pyObj_callback, pyObj_errback, barrier, multi_result);
+              couchbase::core::operations::decrement_request_with_legacy_durability{
+                std::move(req), options->persist_to, options->replicate_to
+              };
+            do_binary_op(*(options->conn), std::move(req_legacy_durability), pyObj_callback, pyObj_errback, barrier, multi_result);
             Py_RETURN_NONE;
         }
         req.durability_level = options->durability_level;
-        do_binary_op(*(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result);
+        do_binary_op(*(options->conn), std::move(req), pyObj_callback, pyObj_errback, barrier, multi_result);
     }
     Py_RETURN_NONE;
 }
@@ -265,14 +246,7 @@ prepare_and_execute_binary_mutation_op(struct binary_mutation_options* options,
     if (!PyBytes_Check(options->pyObj_value)) {
         if (multi_result != nullptr) {
             PyObject* pyObj_exc = pycbc_build_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Value should be bytes object.");
-            if (-1 == PyDict_SetItemString(multi_result->dict, options->id.key().c_str(), pyObj_exc)) {
-                // TODO:  not much we can do here...maybe?
-                PyErr_Print();
-                PyErr_Clear();
-            }
-            Py_DECREF(pyObj_exc);
-            Py_INCREF(Py_False);
-            barrier->set_value(Py_False);
+            add_multi_op_result(multi_result, options->id.key().c_str(), pyObj_exc, false, barrier);
             Py_RETURN_NONE;
         }
         barrier->set_value(nullptr);
@@ -288,14 +262,7 @@ prepare_and_execute_binary_mutation_op(struct binary_mutation_options* options,
     } catch (const std::exception& e) {
         if (multi_result != nullptr) {
             PyObject* pyObj_exc = pycbc_build_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, e.what());
-            if (-1 == PyDict_SetItemString(multi_result->dict, options->id.key().c_str(), pyObj_exc)) {
-                // TODO:  not much we can do here...maybe?
-                PyErr_Print();
-                PyErr_Clear();
-            }
-            Py_DECREF(pyObj_exc);
-            Py_INCREF(Py_False);
-            barrier->set_value(Py_False);
+            add_multi_op_result(multi_result, options->id.key().c_str(), pyObj_exc, false, barrier);
             Py_RETURN_NONE;
         }
         barrier->set_value(nullptr);
@@ -310,36 +277,40 @@ prepare_and_execute_binary_mutation_op(struct binary_mutation_options* options,
         req.timeout = options->timeout_ms;
         // @TODO:  cxx client req doesn't have cas
         // req.cas = options->cas;
-        req.value = value;
+        req.value = std::move(value);
         if (nullptr != options->span) {
             req.parent_span = std::make_shared<pycbc::request_span>(options->span);
         }
         if (options->use_legacy_durability) {
             auto req_legacy_durability =
-              couchbase::core::operations::append_request_with_legacy_durability{ req, options->persist_to, options->replicate_to };
-            do_binary_op(*(options->conn), req_legacy_durability, pyObj_callback, pyObj_errback, barrier, multi_result);
+              couchbase::core::operations::append_request_with_legacy_durability{
+                std::move(req), options->persist_to, options->replicate_to
+              };
+            do_binary_op(*(options->conn), std::move(req_legacy_durability), pyObj_callback, pyObj_errback, barrier, multi_result);
             Py_RETURN_NONE;
         }
         req.durability_level = options->durability_level;
-        do_binary_op(*(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result);
+        do_binary_op(*(options->conn), std::move(req), pyObj_callback, pyObj_errback, barrier, multi_result);
     } else {
         auto req = couchbase::core::operations::prepend_request{ options->id };
         req.timeout = options->timeout_ms;
         // @TODO:  cxx client req doesn't have cas
         // req.cas = options->cas;
-        req.value = value;
+        req.value = std::move(value);
         if (nullptr != options->span) {
             req.parent_span = std::make_shared<pycbc::request_span>(options->span);
         }
         // need to branch if using legacy durability
         if (options->use_legacy_durability) {
             auto req_legacy_durability =
-              couchbase::core::operations::prepend_request_with_legacy_durability{ req, options->persist_to, options->replicate_to };
-            do_binary_op(*(options->conn), req_legacy_durability, pyObj_callback, pyObj_errback, barrier, multi_result);
+              couchbase::core::operations::prepend_request_with_legacy_durability{
+                std::move(req), options->persist_to, options->replicate_to
+              };
+            do_binary_op(*(options->conn), std::move(req_legacy_durability), pyObj_callback, pyObj_errback, barrier, multi_result);
             Py_RETURN_NONE;
         }
         req.durability_level = options->durability_level;
-        do_binary_op(*(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result);
+        do_binary_op(*(options->conn), std::move(req), pyObj_callback, pyObj_errback, barrier, multi_result);
     }
     Py_RETURN_NONE;
 }
@@ -565,10 +536,11 @@ handle_binary_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject
     char* collection = nullptr;
     Operations::OperationType op_type = Operations::UNKNOWN;
     PyObject* pyObj_op_args = nullptr;
+    int stream = 0;
 
-    static const char* kw_list[] = { "conn", "bucket", "scope", "collection_name", "op_type", "op_args", nullptr };
+    static const char* kw_list[] = { "conn", "bucket", "scope", "collection_name", "op_type", "op_args", "stream", nullptr };
 
-    const char* kw_format = "O!sssIO";
+    const char* kw_format = "O!sssIO|i";
     int ret = PyArg_ParseTupleAndKeywords(args,
                                           kwargs,
                                           kw_format,
@@ -579,7 +551,8 @@ handle_binary_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject
                                           &scope,
                                           &collection,
                                           &op_type,
-                                          &pyObj_op_args);
+                                          &pyObj_op_args,
+                                          &stream);
     if (!ret) {
         pycbc_set_python_exception(
           PycbcError::InvalidArgument, __FILE__, __LINE__, "Cannot perform binary operation.  Unable to parse args/kwargs.");
@@ -598,6 +571,12 @@ handle_binary_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject
 
     PyObject* pyObj_multi_result = create_result_obj();
     result* multi_result = reinterpret_cast<result*>(pyObj_multi_result);
+    std::chrono::milliseconds stream_timeout_ms{ 0 };
+    if (stream) {
+        // results are handed out in completion order, the extra pending count keeps the stream open until every key is dispatched
+        multi_result->stream = create_streamed_result_obj(couchbase::core::timeout_defaults::key_value_timeout);
+        multi_result->stream_pending = 1;
+    }
 
     if (pyObj_op_args && PyDict_Check(pyObj_op_args)) {
         PyObject *pyObj_doc_key, *pyObj_op_dict;
@@ -613,13 +592,20 @@ handle_binary_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject
             }
             auto barrier = std::make_shared<std::promise<PyObject*>>();
             auto f = barrier->get_future();
-            if (PyDict_Check(pyObj_op_dict) && !k.empty()) {
+            if (stream) {
+                multi_result->stream_pending++;
+            }
+            if (!PyDict_Check(pyObj_op_dict) || k.empty()) {
+                PyObject* pyObj_exc = pycbc_build_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Invalid key or options.");
+                add_multi_op_result(multi_result, k.c_str(), pyObj_exc, false, barrier);
+            } else {
                 PyObject* pyObj_value = PyDict_GetItemString(pyObj_op_dict, "value");
                 switch (op_type) {
                     case Operations::APPEND:
                     case Operations::PREPEND: {
                         auto opts = get_binary_mutation_options(pyObj_op_dict);
                         opts.conn = conn;
+                        stream_timeout_ms = std::max(stream_timeout_ms, opts.timeout_ms);
                         opts.id = couchbase::core::document_id{ bucket, scope, collection, k };
                         opts.op_type = op_type;
                         if (pyObj_value != nullptr) {
@@ -630,7 +616,7 @@ handle_binary_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject
                             pyObj_op_response = prepare_and_execute_binary_mutation_op(&opts, nullptr, nullptr, barrier, multi_result);
                         } catch (const std::system_error& e) {
                             PyObject* pyObj_exc = pycbc_build_exception(e.code(), __FILE__, __LINE__, e.what());
-                            barrier->set_value(pyObj_exc);
+                            add_multi_op_result(multi_result, k.c_str(), pyObj_exc, false, barrier);
                         }
                         break;
                     }
@@ -638,6 +624,7 @@ handle_binary_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject
                     case Operations::DECREMENT: {
                         auto opts = get_counter_options(pyObj_op_dict);
                         opts.conn = conn;
+                        stream_timeout_ms = std::max(stream_timeout_ms, opts.timeout_ms);
                         opts.id = couchbase::core::document_id{ bucket, scope, collection, k };
                         opts.op_type = op_type;
 
@@ -645,14 +632,14 @@ handle_binary_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject
                             pyObj_op_response = prepare_and_execute_counter_op(&opts, nullptr, nullptr, barrier, multi_result);
                         } catch (const std::system_error& e) {
                             PyObject* pyObj_exc = pycbc_build_exception(e.code(), __FILE__, __LINE__, e.what());
-                            barrier->set_value(pyObj_exc);
+                            add_multi_op_result(multi_result, k.c_str(), pyObj_exc, false, barrier);
                         }
                         break;
                     }
                     default: {
                         PyObject* pyObj_exc = pycbc_build_exception(
                           PycbcError::InvalidArgument, __FILE__, __LINE__, "Unrecognized binary operation passed in.");
-                        barrier->set_value(pyObj_exc);
+                        add_multi_op_result(multi_result, k.c_str(), pyObj_exc, false, barrier);
                         break;
                     }
                 };
@@ -663,6 +650,15 @@ handle_binary_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject
         }
     }
 
+    if (stream) {
+        auto* pyObj_stream = multi_result->stream;
+        pyObj_stream->timeout_ms = std::max(stream_timeout_ms, couchbase::core::timeout_defaults::key_value_timeout);
+        Py_INCREF(reinterpret_cast<PyObject*>(pyObj_stream));
+        // everything is dispatched, drop the guard so the last completion closes the stream
+        release_multi_op_stream(multi_result);
+        return reinterpret_cast<PyObject*>(pyObj_stream);
+    }
+
     auto all_okay = true;
     for (auto i = 0; i < op_results.size(); i++) {
         PyObject* res = nullptr;
@@ -26,13 +26,17 @@
 #include "diagnostics.hxx"
 #include "binary_ops.hxx"
 #include "logger.hxx"
+#include "utils.hxx"
 #include "n1ql.hxx"
 #include "analytics.hxx"
 #include "search.hxx"
 #include "views.hxx"
 #include "management/management.hxx"
 #include "result.hxx"
+#include "kv_result.hxx"
+#include "json_transcoder.hxx"
 #include "transactions/transactions.hxx"
+#include "async_completions.hxx"
 
 void
 add_ops_enum(PyObject* pyObj_module)
@@ -101,6 +105,18 @@ add_constants(PyObject* module)
         Py_XDECREF(module);
         return;
     }
+    if (PyModule_AddIntConstant(module, "READ_MISS_NOT_FOUND", read_miss_not_found) < 0) {
+        Py_XDECREF(module);
+        return;
+    }
+    if (PyModule_AddIntConstant(module, "READ_MISS_CAS_MISMATCH", read_miss_cas_mismatch) < 0) {
+        Py_XDECREF(module);
+        return;
+    }
+    if (PyModule_AddIntConstant(module, "READ_MISS_LOCKED", read_miss_locked) < 0) {
+        Py_XDECREF(module);
+        return;
+    }
     auto cxxcbc_metadata = couchbase::core::meta::sdk_build_info_json();
     if (PyModule_AddStringConstant(module, "CXXCBC_METADATA", cxxcbc_metadata.c_str())) {
         Py_XDECREF(module);
@@ -168,35 +184,15 @@ str_to_service_type(std::string svc)
     return {};
 }
 
-static PyObject* json_module = nullptr;
-static PyObject* json_dumps = nullptr;
-static PyObject* json_loads = nullptr;
-
-// json encode an object using python's json module
+// json encode an object w/ the native transcoder
 std::string
 json_encode(PyObject* obj)
 {
-    // let's import json, we will use it as the default transcoder
-    if (nullptr == json_dumps || nullptr == json_module) {
-        json_module = PyImport_ImportModule("json");
-        if (nullptr != json_module) {
-            json_dumps = PyObject_GetAttrString(json_module, "dumps");
-        } else {
-            PyErr_PrintEx(1);
-            return {};
-        }
-    }
-    // call json.dumps(obj)
-    PyObject* args = PyTuple_Pack(1, obj);
-    PyObject* encoded = PyObject_CallObject(json_dumps, args);
-    Py_XDECREF(args);
-    std::string res = std::string();
-    if (PyUnicode_Check(encoded)) {
-        res = std::string(PyUnicode_AsUTF8(encoded));
+    couchbase::core::utils::binary encoded{};
+    if (!pycbc_json_encode(obj, encoded)) {
+        return {};
     }
-    Py_XDECREF(encoded);
-    // CB_LOG_DEBUG("encoded document: {}", res);
-    return res;
+    return std::string{ reinterpret_cast<const char*>(encoded.data()), encoded.size() };
 }
 
 std::tuple<std::string, uint32_t>
@@ -306,32 +302,7 @@ decode_value(const PyObject* transcoder, const char* value, size_t nvalue, uint3
 PyObject*
 json_decode(const char* value, size_t nvalue)
 {
-    if (nullptr == json_loads || nullptr == json_module) {
-        json_module = PyImport_ImportModule("json");
-        if (nullptr != json_module) {
-            json_loads = PyObject_GetAttrString(json_module, "loads");
-        } else {
-            PyErr_PrintEx(1);
-            return nullptr;
-        }
-    }
-
-    PyObject* unicode = nullptr;
-
-    // PyUnicode_FromString
-    unicode = PyUnicode_DecodeUTF8(value, nvalue, "strict");
-
-    if (!unicode) {
-        // TODO:  raise an exception here
-        PyErr_PrintEx(1);
-        return nullptr;
-    }
-
-    PyObject* args = PyTuple_Pack(1, unicode);
-    PyObject* decoded = PyObject_CallObject(json_loads, args);
-
-    Py_XDECREF(args);
-    return decoded;
+    return pycbc_json_decode(value, nvalue);
 }
 
 static PyObject*
@@ -374,6 +345,16 @@ kv_multi_operation(PyObject* self, PyObject* args, PyObject* kwargs)
     return res;
 }
 
+static PyObject*
+kv_bulk_operation(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+    PyObject* res = handle_kv_bulk_op(self, args, kwargs);
+    if (res == nullptr && PyErr_Occurred() == nullptr) {
+        pycbc_set_python_exception(PycbcError::UnsuccessfulOperation, __FILE__, __LINE__, "Unable to perform KV bulk operation.");
+    }
+    return res;
+}
+
 static PyObject*
 subdoc_operation(PyObject* self, PyObject* args, PyObject* kwargs)
 {
@@ -384,6 +365,16 @@ subdoc_operation(PyObject* self, PyObject* args, PyObject* kwargs)
     return res;
 }
 
+static PyObject*
+subdoc_multi_operation(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+    PyObject* res = handle_subdoc_multi_op(self, args, kwargs);
+    if (res == nullptr && PyErr_Occurred() == nullptr) {
+        pycbc_set_python_exception(PycbcError::UnsuccessfulOperation, __FILE__, __LINE__, "Unable to perform subdoc multi operation.");
+    }
+    return res;
+}
+
 static PyObject*
 diagnostics_operation(PyObject* self, PyObject* args, PyObject* kwargs)
 {
@@ -486,6 +477,26 @@ get_connection_information(PyObject* self, PyObject* args, PyObject* kwargs)
     return res;
 }
 
+static PyObject*
+configure_read_cache(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+    PyObject* res = handle_configure_read_cache(self, args, kwargs);
+    if (res == nullptr && PyErr_Occurred() == nullptr) {
+        pycbc_set_python_exception(PycbcError::UnsuccessfulOperation, __FILE__, __LINE__, "Unable to configure read cache.");
+    }
+    return res;
+}
+
+static PyObject*
+prepare_statements(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+    PyObject* res = handle_prepare_statements(self, args, kwargs);
+    if (res == nullptr && PyErr_Occurred() == nullptr) {
+        pycbc_set_python_exception(PycbcError::UnsuccessfulOperation, __FILE__, __LINE__, "Unable to prepare statements.");
+    }
+    return res;
+}
+
 static PyObject*
 close_connection(PyObject* self, PyObject* args, PyObject* kwargs)
 {
@@ -501,18 +512,33 @@ static struct PyMethodDef methods[] = {
     { "get_connection_info", (PyCFunction)get_connection_information, METH_VARARGS | METH_KEYWORDS, "Get connection options" },
     { "open_or_close_bucket", (PyCFunction)open_or_close_bucket, METH_VARARGS | METH_KEYWORDS, "Open or close a bucket" },
     { "close_connection", (PyCFunction)close_connection, METH_VARARGS | METH_KEYWORDS, "Close a connection" },
+    { "configure_read_cache",
+      (PyCFunction)configure_read_cache,
+      METH_VARARGS | METH_KEYWORDS,
+      "Configure the document read cache of a collection" },
     { "kv_operation", (PyCFunction)kv_operation, METH_VARARGS | METH_KEYWORDS, "Handle all key/value operations" },
     { "kv_multi_operation", (PyCFunction)kv_multi_operation, METH_VARARGS | METH_KEYWORDS, "Handle all key/value multi operations" },
+    { "kv_bulk_operation", (PyCFunction)kv_bulk_operation, METH_VARARGS | METH_KEYWORDS, "Handle windowed key/value bulk mutations" },
     { "subdoc_operation", (PyCFunction)subdoc_operation, METH_VARARGS | METH_KEYWORDS, "Handle all subdoc operations" },
+    { "subdoc_multi_operation",
+      (PyCFunction)subdoc_multi_operation,
+      METH_VARARGS | METH_KEYWORDS,
+      "Handle all subdoc multi operations" },
     { "binary_operation", (PyCFunction)binary_operation, METH_VARARGS | METH_KEYWORDS, "Handle all binary operations" },
     { "binary_multi_operation", (PyCFunction)binary_multi_operation, METH_VARARGS | METH_KEYWORDS, "Handle all binary multi operations" },
     { "diagnostics_operation", (PyCFunction)diagnostics_operation, METH_VARARGS | METH_KEYWORDS, "Handle all diagnostics operations" },
     { "n1ql_query", (PyCFunction)n1ql_query, METH_VARARGS | METH_KEYWORDS, "Execute N1QL Query" },
+    { "prepare_statements",
+      (PyCFunction)prepare_statements,
+      METH_VARARGS | METH_KEYWORDS,
+      "Prepare N1QL statements ahead of their first adhoc=false query" },
     { "analytics_query", (PyCFunction)analytics_query, METH_VARARGS | METH_KEYWORDS, "Execute analytics Query" },
     { "search_query", (PyCFunction)search_query, METH_VARARGS | METH_KEYWORDS, "Execute search Query" },
     { "view_query", (PyCFunction)view_query, METH_VARARGS | METH_KEYWORDS, "Execute map reduce views Query" },
     { "cluster_info", (PyCFunction)cluster_info, METH_VARARGS | METH_KEYWORDS, "Get information on the connected cluster" },
     { "management_operation", (PyCFunction)management_operation, METH_VARARGS | METH_KEYWORDS, "Handle all management operations" },
+    { "json_encode", (PyCFunction)pycbc_json_encode_method, METH_VARARGS, "Encode a Python object as JSON bytes" },
+    { "json_decode", (PyCFunction)pycbc_json_decode_method, METH_VARARGS, "Decode a JSON document into Python objects" },
     { "create_transactions", (PyCFunction)pycbc_txns::create_transactions, METH_VARARGS | METH_KEYWORDS, "Create a transactions object" },
     { "run_transaction", (PyCFunction)pycbc_txns::run_transactions, METH_VARARGS | METH_KEYWORDS, "Run a transaction" },
     { "transaction_op", (PyCFunction)pycbc_txns::transaction_op, METH_VARARGS | METH_KEYWORDS, "perform a transaction kv operation" },
@@ -563,11 +589,55 @@ PyInit_pycbc_core(void)
         return nullptr;
     }
 
+    PyObject* get_result_type;
+    if (pycbc_get_result_type_init(&get_result_type) < 0) {
+        return nullptr;
+    }
+
+    PyObject* mutation_result_type;
+    if (pycbc_mutation_result_type_init(&mutation_result_type) < 0) {
+        return nullptr;
+    }
+
+    PyObject* exists_result_type;
+    if (pycbc_exists_result_type_init(&exists_result_type) < 0) {
+        return nullptr;
+    }
+
+    PyObject* miss_result_type;
+    if (pycbc_miss_result_type_init(&miss_result_type) < 0) {
+        return nullptr;
+    }
+
+    PyObject* subdoc_spec_type;
+    if (pycbc_subdoc_spec_type_init(&subdoc_spec_type) < 0) {
+        return nullptr;
+    }
+
+    PyObject* kv_handle_type;
+    if (pycbc_kv_handle_type_init(&kv_handle_type) < 0) {
+        return nullptr;
+    }
+
+    PyObject* async_completions_type;
+    if (pycbc_async_completions_type_init(&async_completions_type) < 0) {
+        return nullptr;
+    }
+
+    PyObject* async_completion_type;
+    if (pycbc_async_completion_type_init(&async_completion_type) < 0) {
+        return nullptr;
+    }
+
     PyObject* pycbc_logger_type;
     if (pycbc_logger_type_init(&pycbc_logger_type) < 0) {
         return nullptr;
     }
 
+    if (pycbc_binary_buffer_type_init() < 0) {
+        return nullptr;
+    }
+
     m = PyModule_Create(&pycbc_core_module);
     if (m == nullptr) {
         return nullptr;
@@ -601,6 +671,55 @@ PyInit_pycbc_core(void)
         return nullptr;
     }
 
+    Py_INCREF(get_result_type);
+    if (PyModule_AddObject(m, "get_result", get_result_type) < 0) {
+        Py_DECREF(get_result_type);
+        Py_DECREF(m);
+        return nullptr;
+    }
+
+    Py_INCREF(mutation_result_type);
+    if (PyModule_AddObject(m, "mutation_result", mutation_result_type) < 0) {
+        Py_DECREF(mutation_result_type);
+        Py_DECREF(m);
+        return nullptr;
+    }
+
+    Py_INCREF(exists_result_type);
+    if (PyModule_AddObject(m, "exists_result", exists_result_type) < 0) {
+        Py_DECREF(exists_result_type);
+        Py_DECREF(m);
+        return nullptr;
+    }
+
+    Py_INCREF(miss_result_type);
+    if (PyModule_AddObject(m, "miss_result", miss_result_type) < 0) {
+        Py_DECREF(miss_result_type);
+        Py_DECREF(m);
+        return nullptr;
+    }
+
+    Py_INCREF(subdoc_spec_type);
+    if (PyModule_AddObject(m, "subdoc_spec", subdoc_spec_type) < 0) {
+        Py_DECREF(subdoc_spec_type);
+        Py_DECREF(m);
+        return nullptr;
+    }
+
+    Py_INCREF(kv_handle_type);
+    if (PyModule_AddObject(m, "kv_handle", kv_handle_type) < 0) {
+        Py_DECREF(kv_handle_type);
+        Py_DECREF(m);
+        return nullptr;
+    }
+
+    Py_INCREF(async_completions_type);
+    if (PyModule_AddObject(m, "async_completions", async_completions_type) < 0) {
+        Py_DECREF(async_completions_type);
+        Py_DECREF(m);
+        return nullptr;
+    }
+
     Py_INCREF(pycbc_logger_type);
     if (PyModule_AddObject(m, "pycbc_logger", pycbc_logger_type) < 0) {
         Py_DECREF(pycbc_logger_type);
@@ -24,10 +24,20 @@
 #include <core/cluster.hxx>
 #include <core/logger/logger.hxx>
 #include <core/meta/version.hxx>
+#include <atomic>
 #include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 #include "result.hxx"
 #include "exceptions.hxx"
+#include "completion_queue.hxx"
+#include "read_cache.hxx"
+#include "prepared_cache.hxx"
 
 #define PY_SSIZE_T_CLEAN
 
@@ -229,25 +239,293 @@ struct callback_context {
 #define RESULT_KEY "key"
 #define RESULT_MUTATION_TOKEN "mutation_token"
 #define RESULT_EXISTS "exists"
+// set when the value has already been decoded by the native JSON decoder
+#define RESULT_VALUE_DECODED "value_decoded"
+// read-only memoryview over the raw value, only created on request (never part of raw_result)
+#define RESULT_VALUE_VIEW "value_view"
 #define TRANSCODER_ENCODE "encode_value"
 #define SERIALIZE "serialize"
 #define TRANSCODER_DECODE "decode_value"
 #define DESERIALIZE "deserialize"
 
+/**
+ * When io_sharding is enabled each IO thread owns one of these.  The io_context is only ever run from the
+ * owning thread (hence the concurrency hint), so the sockets, timers and completion handlers of the shard's
+ * cluster never contend with the other IO threads.
+ *
+ * The shard's cluster is a complete one: it bootstraps on its own and keeps its own connections to every node,
+ * so io_sharding multiplies the number of connections to the cluster by the number of shards (plus the
+ * primary cluster's).
+ */
+struct io_shard {
+    asio::io_context io_{ 1 };
+    std::shared_ptr<couchbase::core::cluster> cluster_;
+    // number of KV operations submitted to the shard that have not completed yet
+    std::atomic<std::size_t> queue_depth_{ 0 };
+    std::atomic<std::uint64_t> completed_{ 0 };
+
+    io_shard()
+      : cluster_{ couchbase::core::cluster::create(io_) }
+    {
+    }
+};
+
+/**
+ * A KV read other callers asked for while it was in flight.  All waiters are completed from the one response,
+ * in the order they attached.
+ */
+struct coalesced_read {
+    struct waiter {
+        PyObject* pyObj_callback;
+        PyObject* pyObj_errback;
+        std::shared_ptr<std::promise<PyObject*>> barrier;
+        result* multi_result;
+        std::uint8_t miss_errors;
+    };
+    std::vector<waiter> waiters;
+};
+
 struct connection {
     asio::io_context io_;
     std::shared_ptr<couchbase::core::cluster> cluster_;
     std::list<std::thread> io_threads_;
-
-    connection(int num_io_threads)
+    // empty unless io_sharding is enabled; cluster_ then only handles bootstrap, HTTP services and management
+    std::vector<std::unique_ptr<io_shard>> shards_;
+    // KV and management responses are handed to the dispatcher so the IO threads never wait on the GIL
+    completion_queue completions_;
+    std::thread dispatcher_;
+    // set when the connection was deallocated from a callback, i.e. on the dispatcher itself, which then frees it
+    std::atomic<bool> release_on_dispatcher_exit_{ false };
+    // opt-in per collection document caches, keyed by bucket/scope/collection
+    std::mutex read_caches_mutex_;
+    std::map<std::string, std::shared_ptr<read_cache>> read_caches_;
+    std::atomic<std::size_t> read_cache_count_{ 0 };
+    // reads sent on behalf of several callers, keyed by document and then by operation.  Entries are added when a
+    // read is issued, removed by its response handler and detached by any mutation of the document
+    bool coalesce_reads_{ false };
+    std::mutex inflight_reads_mutex_;
+    std::unordered_map<std::string, std::unordered_map<std::string, std::shared_ptr<coalesced_read>>> inflight_reads_;
+    std::atomic<std::uint64_t> coalesced_reads_{ 0 };
+    // a GET still outstanding after this long is also sent to the replicas, zero disables hedging
+    std::chrono::microseconds hedge_reads_after_{ 0 };
+    std::atomic<std::uint64_t> hedged_reads_{ 0 };
+    std::atomic<std::uint64_t> hedged_reads_won_{ 0 };
+    // rows of a streaming query/analytics response buffered ahead of the iterator before reading pauses, zero is unbounded
+    std::size_t stream_high_water_rows_{ 0 };
+    std::size_t stream_high_water_bytes_{ 0 };
+    // null unless a high water mark is set, the cluster (and IO thread) flow-controlled streams are read on
+    std::unique_ptr<io_shard> stream_io_{};
+    // names of statements prepared for queries w/ adhoc=false, null unless enabled w/ a size
+    std::unique_ptr<prepared_statement_cache> prepared_cache_{};
+    prepare_single_flight<couchbase::core::operations::query_response> prepares_in_flight_{};
+
+    connection(int num_io_threads, bool io_sharding = false)
     {
         cluster_ = couchbase::core::cluster::create(io_);
+        dispatcher_ = std::thread([this] {
+            completions_.run();
+            if (release_on_dispatcher_exit_.load()) {
+                delete this;
+            }
+        });
+        if (io_sharding) {
+            io_threads_.emplace_back([&] { io_.run(); });
+            for (int i = 0; i < num_io_threads; i++) {
+                auto* shard = shards_.emplace_back(std::make_unique<io_shard>()).get();
+                io_threads_.emplace_back([shard] { shard->io_.run(); });
+            }
+            return;
+        }
         for (int i = 0; i < num_io_threads; i++) {
             // TODO: consider maybe catching exceptions and running run() again?  For now, lets
             // log the exception and rethrow (which will lead to a crash)
             io_threads_.emplace_back([&] { io_.run(); });
         }
     }
+
+    /**
+     * All clusters owned by the connection, the primary cluster first.  Bucket open/close and shutdown
+     * need to be applied to each of them.
+     */
+    std::vector<std::shared_ptr<couchbase::core::cluster>> clusters() const
+    {
+        std::vector<std::shared_ptr<couchbase::core::cluster>> clusters{ cluster_ };
+        for (const auto& shard : shards_) {
+            clusters.emplace_back(shard->cluster_);
+        }
+        if (stream_io_) {
+            clusters.emplace_back(stream_io_->cluster_);
+        }
+        return clusters;
+    }
+
+    void stop()
+    {
+        io_.stop();
+        for (auto& shard : shards_) {
+            shard->io_.stop();
+        }
+        if (stream_io_) {
+            stream_io_->io_.stop();
+        }
+    }
+
+    /**
+     * A flow-controlled stream (see row_stream) holds the IO thread reading it while its iterator lags behind, so
+     * those streams get a cluster of their own, w/ separate HTTP connections and IO thread, and KV operations or
+     * other requests are never stuck behind them.  Must be called before the clusters are opened.
+     */
+    void enable_stream_io()
+    {
+        stream_io_ = std::make_unique<io_shard>();
+        io_threads_.emplace_back([shard = stream_io_.get()] { shard->io_.run(); });
+    }
+
+    // the cluster to send query/analytics requests w/ a row callback to
+    const std::shared_ptr<couchbase::core::cluster>& stream_cluster() const
+    {
+        return stream_io_ ? stream_io_->cluster_ : cluster_;
+    }
+
+    // a document is always handled by the same shard, so its IO stays on the owning thread.  Keys are spread by
+    // their hash, not by the node owning their vbucket, so every shard talks to every node
+    io_shard* shard_for(const couchbase::core::document_id& id) const
+    {
+        if (shards_.empty()) {
+            return nullptr;
+        }
+        return shards_[std::hash<std::string>{}(id.key()) % shards_.size()].get();
+    }
+
+    static std::string read_cache_name(const std::string& bucket, const std::string& scope, const std::string& collection)
+    {
+        return bucket + "/" + scope + "/" + collection;
+    }
+
+    // the cache configured for the document's collection, most connections have none so skip the lock then
+    std::shared_ptr<read_cache> read_cache_for(const couchbase::core::document_id& id)
+    {
+        if (read_cache_count_.load(std::memory_order_relaxed) == 0) {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> lock(read_caches_mutex_);
+        auto it = read_caches_.find(read_cache_name(id.bucket(), id.scope(), id.collection()));
+        return it == read_caches_.end() ? nullptr : it->second;
+    }
+
+    void set_read_cache(const std::string& name, std::shared_ptr<read_cache> cache)
+    {
+        std::lock_guard<std::mutex> lock(read_caches_mutex_);
+        if (cache) {
+            read_caches_[name] = std::move(cache);
+        } else {
+            read_caches_.erase(name);
+        }
+        read_cache_count_ = read_caches_.size();
+    }
+
+    /**
+     * Wrap a response handler so that it runs on the dispatcher thread (with the GIL held) instead of the
+     * IO thread that received the response.  prepare(const Response&) still runs on the IO thread, w/o the
+     * GIL, so any work that does not need Python (e.g. parsing the document) is moved off the dispatcher.
+     */
+    template<typename Response, typename Handler, typename Prepare>
+    auto defer(Handler&& handler, Prepare&& prepare)
+    {
+        return [this, handler = std::forward<Handler>(handler), prepare = std::forward<Prepare>(prepare)](Response resp) mutable {
+            prepare(static_cast<const Response&>(resp));
+            completions_.push([handler = std::move(handler), resp = std::move(resp)]() mutable { handler(std::move(resp)); });
+        };
+    }
+
+    template<typename Response, typename Handler>
+    auto defer(Handler&& handler)
+    {
+        return defer<Response>(std::forward<Handler>(handler), [](const Response&) {});
+    }
+
+    /**
+     * Execute a KV request, routing it to the owning shard when io_sharding is enabled.
+     */
+    template<typename Request, typename Handler, typename Prepare>
+    void execute(Request req, Handler&& handler, Prepare&& prepare)
+    {
+        using response_type = typename Request::response_type;
+        auto* shard = shard_for(req.id);
+        if (shard == nullptr) {
+            cluster_->execute(std::move(req), defer<response_type>(std::forward<Handler>(handler), std::forward<Prepare>(prepare)));
+            return;
+        }
+        shard->queue_depth_++;
+        // counted on the shard's IO thread, a busy dispatcher does not make the shard look backed up
+        shard->cluster_->execute(std::move(req),
+                                 defer<response_type>(std::forward<Handler>(handler),
+                                                      [shard, prepare = std::forward<Prepare>(prepare)](const response_type& resp) mutable {
+                                                          shard->queue_depth_--;
+                                                          shard->completed_++;
+                                                          prepare(resp);
+                                                      }));
+    }
+
+    template<typename Request, typename Handler>
+    void execute(Request req, Handler&& handler)
+    {
+        using response_type = typename Request::response_type;
+        execute(std::move(req), std::forward<Handler>(handler), [](const response_type&) {});
+    }
+
+    static std::string inflight_read_name(const couchbase::core::document_id& id)
+    {
+        return read_cache_name(id.bucket(), id.scope(), id.collection()) + "/" + id.key();
+    }
+
+    // reads of the document that are in flight may be answered w/ what it held before a mutation, callers
+    // asking from now on send a new request instead of attaching to them
+    void detach_inflight_reads(const std::string& name)
+    {
+        std::lock_guard<std::mutex> lock(inflight_reads_mutex_);
+        inflight_reads_.erase(name);
+    }
+
+    /**
+     * Execute a KV request that changes the document: its value, or its CAS, expiry or lock (touch, get-and-lock,
+     * ...).  The key is dropped from the collection's read cache, and in-flight coalesced reads of it are
+     * detached, when the request is dispatched and again once it completed (on the IO thread, before prepare
+     * and so before the caller sees the result).  Neither a GET that raced the write nor one issued after it
+     * can then return the old document.
+     */
+    template<typename Request, typename Handler, typename Prepare>
+    void execute_mutation(Request req, Handler&& handler, Prepare&& prepare)
+    {
+        using response_type = typename Request::response_type;
+        auto cache = read_cache_for(req.id);
+        if (!cache && !coalesce_reads_) {
+            execute(std::move(req), std::forward<Handler>(handler), std::forward<Prepare>(prepare));
+            return;
+        }
+        auto invalidate = [this, cache = std::move(cache), key = req.id.key(), name = inflight_read_name(req.id)]() {
+            if (cache) {
+                cache->invalidate(key);
+            }
+            if (coalesce_reads_) {
+                detach_inflight_reads(name);
+            }
+        };
+        invalidate();
+        execute(std::move(req),
+                std::forward<Handler>(handler),
+                [invalidate = std::move(invalidate), prepare = std::forward<Prepare>(prepare)](const response_type& resp) mutable {
+                    invalidate();
+                    prepare(resp);
+                });
+    }
+
+    template<typename Request, typename Handler>
+    void execute_mutation(Request req, Handler&& handler)
+    {
+        using response_type = typename Request::response_type;
+        execute_mutation(std::move(req), std::forward<Handler>(handler), [](const response_type&) {});
+    }
 };
 
 void
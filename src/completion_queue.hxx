@@ -0,0 +1,150 @@
+/*
+ *   Copyright 2016-2022. Couchbase, Inc.
+ *   All Rights Reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#pragma once
+
+// NOLINTNEXTLINE
+#include "Python.h" // NOLINT
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+/**
+ * Multi-producer/single-consumer queue of response handlers.
+ *
+ * The IO threads push completions without touching the GIL (a single CAS on the list head), the
+ * dispatcher thread takes the whole list in one exchange and runs the handlers in submission order
+ * while holding the GIL once per batch.
+ */
+class completion_queue
+{
+  public:
+    static constexpr std::size_t max_batch_size = 128;
+
+    completion_queue() = default;
+    completion_queue(const completion_queue&) = delete;
+    completion_queue& operator=(const completion_queue&) = delete;
+
+    ~completion_queue()
+    {
+        // anything left over was never dispatched, the interpreter might be gone so only free the nodes
+        auto* node = _head.exchange(nullptr);
+        while (node != nullptr) {
+            auto* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    template<typename Handler>
+    void push(Handler&& handler)
+    {
+        auto* node = new completion_impl<std::decay_t<Handler>>(std::forward<Handler>(handler));
+        node->next = _head.load(std::memory_order_relaxed);
+        while (!_head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        if (node->next == nullptr) {
+            // queue went from empty to non-empty, the dispatcher might be parked
+            std::lock_guard<std::mutex> lock(_mut);
+            _cond.notify_one();
+        }
+    }
+
+    /**
+     * Dispatcher loop, returns once stop() has been called and the queue is drained.
+     */
+    void run()
+    {
+        while (true) {
+            auto* batch = take();
+            if (batch == nullptr) {
+                return;
+            }
+            while (batch != nullptr) {
+                PyGILState_STATE state = PyGILState_Ensure();
+                for (std::size_t count = 0; batch != nullptr && count < max_batch_size; count++) {
+                    auto* next = batch->next;
+                    batch->invoke();
+                    delete batch;
+                    batch = next;
+                }
+                // give other Python threads a chance to run between large batches
+                PyGILState_Release(state);
+            }
+        }
+    }
+
+    void stop()
+    {
+        std::lock_guard<std::mutex> lock(_mut);
+        _stopped = true;
+        _cond.notify_one();
+    }
+
+  private:
+    struct completion {
+        completion* next{ nullptr };
+        virtual ~completion() = default;
+        virtual void invoke() = 0;
+    };
+
+    template<typename Handler>
+    struct completion_impl : completion {
+        Handler handler;
+
+        explicit completion_impl(Handler&& h)
+          : handler{ std::move(h) }
+        {
+        }
+
+        explicit completion_impl(const Handler& h)
+          : handler{ h }
+        {
+        }
+
+        void invoke() override
+        {
+            handler();
+        }
+    };
+
+    // blocks until there is work, returns the pending completions oldest first
+    completion* take()
+    {
+        auto* node = _head.exchange(nullptr, std::memory_order_acquire);
+        if (node == nullptr) {
+            std::unique_lock<std::mutex> lock(_mut);
+            _cond.wait(lock, [this] { return _stopped || _head.load(std::memory_order_acquire) != nullptr; });
+            node = _head.exchange(nullptr, std::memory_order_acquire);
+        }
+        completion* ordered = nullptr;
+        while (node != nullptr) {
+            auto* next = node->next;
+            node->next = ordered;
+            ordered = node;
+            node = next;
+        }
+        return ordered;
+    }
+
+    std::atomic<completion*> _head{ nullptr };
+    std::mutex _mut;
+    std::condition_variable _cond;
+    bool _stopped{ false };
+};
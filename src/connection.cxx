@@ -20,6 +20,8 @@
 #include "tracing.hxx"
 #include "metrics.hxx"
 #include <core/io/ip_protocol.hxx>
+#include <functional>
+#include <mutex>
 
 couchbase::core::io::ip_protocol
 pyObj_to_ip_protocol(std::string ip_protocol)
@@ -69,6 +71,46 @@ tls_verify_mode_to_pyObj(couchbase::core::tls_verify_mode tls_verify_mode)
     }
 }
 
+struct cluster_fan_in {
+    std::mutex mut;
+    std::size_t remaining;
+    std::error_code ec{};
+    std::function<void(std::error_code)> handler;
+};
+
+/**
+ * Runs op against every cluster owned by the connection (only the primary cluster unless io_sharding is
+ * enabled or a stream high water mark is set) and calls handler once, with the first error seen, after all of
+ * them have completed.
+ */
+template<typename Operation>
+void
+execute_on_all_clusters(connection* conn, Operation&& op, std::function<void(std::error_code)> handler)
+{
+    auto clusters = conn->clusters();
+    auto state = std::make_shared<cluster_fan_in>();
+    state->remaining = clusters.size();
+    state->handler = std::move(handler);
+    for (auto& cluster : clusters) {
+        op(*cluster, [state, callback_count = 0](std::error_code ec) mutable {
+            if (callback_count++ > 0) {
+                return;
+            }
+            bool done = false;
+            {
+                std::lock_guard<std::mutex> lock(state->mut);
+                if (ec && !state->ec) {
+                    state->ec = ec;
+                }
+                done = --state->remaining == 0;
+            }
+            if (done) {
+                state->handler(state->ec);
+            }
+        });
+    }
+}
+
 static void
 dealloc_conn(PyObject* obj)
 {
@@ -76,14 +118,32 @@ dealloc_conn(PyObject* obj)
     if (conn) {
         auto barrier = std::make_shared<std::promise<void>>();
         auto f = barrier->get_future();
-        conn->cluster_->close([barrier]() { barrier->set_value(); });
+        execute_on_all_clusters(
+          conn,
+          [](couchbase::core::cluster& cluster, auto&& handler) { cluster.close([handler]() mutable { handler({}); }); },
+          [barrier](std::error_code) { barrier->set_value(); });
         f.get();
-        conn->io_.stop();
+        conn->stop();
         for (auto& t : conn->io_threads_) {
             if (t.joinable()) {
                 t.join();
             }
         }
+        if (std::this_thread::get_id() == conn->dispatcher_.get_id()) {
+            // the last reference was dropped by a callback, the dispatcher cannot join itself.  It drains the
+            // remaining completions once this one returns and then frees the connection
+            conn->dispatcher_.detach();
+            conn->release_on_dispatcher_exit_ = true;
+            conn->completions_.stop();
+            CB_LOG_DEBUG("{}: dealloc_conn deferred to the dispatcher", "PYCBC");
+            return;
+        }
+        // the dispatcher drains the remaining completions before it exits, it needs the GIL to do so
+        conn->completions_.stop();
+        if (conn->dispatcher_.joinable()) {
+            Py_BEGIN_ALLOW_THREADS conn->dispatcher_.join();
+            Py_END_ALLOW_THREADS
+        }
     }
     CB_LOG_DEBUG("{}: dealloc_conn completed", "PYCBC");
     delete conn;
@@ -175,7 +235,7 @@ close_connection_callback(PyObject* pyObj_conn,
     }
     CB_LOG_DEBUG("{}: close conn callback completed", "PYCBC");
     auto conn = reinterpret_cast<connection*>(PyCapsule_GetPointer(pyObj_conn, "conn_"));
-    conn->io_.stop();
+    conn->stop();
     // the pyObj_conn was incref'd before being passed into this callback, decref it here
     Py_DECREF(pyObj_conn);
     PyGILState_Release(state);
@@ -785,7 +845,34 @@ handle_create_connection([[maybe_unused]] PyObject* self, PyObject* args, PyObje
         num_io_threads = static_cast<uint32_t>(PyLong_AsUnsignedLong(pyObj_num_io_threads));
     }
 
-    connection* const conn = new connection(num_io_threads);
+    PyObject* pyObj_io_sharding = PyDict_GetItemString(pyObj_options, "io_sharding");
+    bool io_sharding = pyObj_io_sharding != nullptr && pyObj_io_sharding == Py_True;
+
+    connection* const conn = new connection(num_io_threads, io_sharding);
+    PyObject* pyObj_coalesce_reads = PyDict_GetItemString(pyObj_options, "coalesce_reads");
+    conn->coalesce_reads_ = pyObj_coalesce_reads != nullptr && pyObj_coalesce_reads == Py_True;
+    PyObject* pyObj_hedge_reads_after = PyDict_GetItemString(pyObj_options, "hedge_reads_after");
+    if (pyObj_hedge_reads_after != nullptr) {
+        conn->hedge_reads_after_ = std::chrono::microseconds(PyLong_AsUnsignedLongLong(pyObj_hedge_reads_after));
+    }
+    PyObject* pyObj_stream_high_water_rows = PyDict_GetItemString(pyObj_options, "stream_high_water_rows");
+    if (pyObj_stream_high_water_rows != nullptr) {
+        conn->stream_high_water_rows_ = static_cast<std::size_t>(PyLong_AsUnsignedLongLong(pyObj_stream_high_water_rows));
+    }
+    PyObject* pyObj_stream_high_water_bytes = PyDict_GetItemString(pyObj_options, "stream_high_water_bytes");
+    if (pyObj_stream_high_water_bytes != nullptr) {
+        conn->stream_high_water_bytes_ = static_cast<std::size_t>(PyLong_AsUnsignedLongLong(pyObj_stream_high_water_bytes));
+    }
+    if (conn->stream_high_water_rows_ > 0 || conn->stream_high_water_bytes_ > 0) {
+        conn->enable_stream_io();
+    }
+    PyObject* pyObj_prepared_statement_cache_size = PyDict_GetItemString(pyObj_options, "prepared_statement_cache_size");
+    if (pyObj_prepared_statement_cache_size != nullptr) {
+        auto size = static_cast<std::size_t>(PyLong_AsUnsignedLongLong(pyObj_prepared_statement_cache_size));
+        if (size > 0) {
+            conn->prepared_cache_ = std::make_unique<prepared_statement_cache>(size);
+        }
+    }
     PyObject* pyObj_conn = PyCapsule_New(conn, "conn_", dealloc_conn);
 
     if (pyObj_conn == nullptr) {
@@ -804,14 +891,12 @@ handle_create_connection([[maybe_unused]] PyObject* self, PyObject* args, PyObje
     auto barrier = std::make_shared<std::promise<PyObject*>>();
     auto f = barrier->get_future();
     {
-        int callback_count = 0;
-        Py_BEGIN_ALLOW_THREADS conn->cluster_->open(
-          couchbase::core::origin(auth, connection_str),
-          [pyObj_conn, pyObj_callback, pyObj_errback, callback_count, barrier](std::error_code ec) mutable {
-              if (callback_count == 0) {
-                  create_connection_callback(pyObj_conn, ec, pyObj_callback, pyObj_errback, barrier);
-              }
-              callback_count++;
+        auto origin = couchbase::core::origin(auth, connection_str);
+        Py_BEGIN_ALLOW_THREADS execute_on_all_clusters(
+          conn,
+          [&origin](couchbase::core::cluster& cluster, auto&& handler) { cluster.open(origin, std::move(handler)); },
+          [pyObj_conn, pyObj_callback, pyObj_errback, barrier](std::error_code ec) {
+              create_connection_callback(pyObj_conn, ec, pyObj_callback, pyObj_errback, barrier);
           });
         Py_END_ALLOW_THREADS
     }
@@ -1095,6 +1180,167 @@ get_connection_info([[maybe_unused]] PyObject* self, PyObject* args, PyObject* k
     }
     Py_XDECREF(pyObj_tmp);
 
+    if (-1 == PyDict_SetItemString(pyObj_opts, "io_sharding", conn->shards_.empty() ? Py_False : Py_True)) {
+        PyErr_Print();
+        PyErr_Clear();
+    }
+
+    if (-1 == PyDict_SetItemString(pyObj_opts, "coalesce_reads", conn->coalesce_reads_ ? Py_True : Py_False)) {
+        PyErr_Print();
+        PyErr_Clear();
+    }
+
+    pyObj_tmp = PyLong_FromUnsignedLongLong(conn->coalesced_reads_.load());
+    if (-1 == PyDict_SetItemString(pyObj_opts, "coalesced_reads", pyObj_tmp)) {
+        PyErr_Print();
+        PyErr_Clear();
+    }
+    Py_XDECREF(pyObj_tmp);
+
+    if (conn->hedge_reads_after_.count() > 0) {
+        pyObj_tmp = PyLong_FromLongLong(conn->hedge_reads_after_.count());
+        if (-1 == PyDict_SetItemString(pyObj_opts, "hedge_reads_after", pyObj_tmp)) {
+            PyErr_Print();
+            PyErr_Clear();
+        }
+        Py_XDECREF(pyObj_tmp);
+    }
+
+    if (conn->stream_high_water_rows_ > 0) {
+        pyObj_tmp = PyLong_FromSize_t(conn->stream_high_water_rows_);
+        if (-1 == PyDict_SetItemString(pyObj_opts, "stream_high_water_rows", pyObj_tmp)) {
+            PyErr_Print();
+            PyErr_Clear();
+        }
+        Py_XDECREF(pyObj_tmp);
+    }
+
+    if (conn->stream_high_water_bytes_ > 0) {
+        pyObj_tmp = PyLong_FromSize_t(conn->stream_high_water_bytes_);
+        if (-1 == PyDict_SetItemString(pyObj_opts, "stream_high_water_bytes", pyObj_tmp)) {
+            PyErr_Print();
+            PyErr_Clear();
+        }
+        Py_XDECREF(pyObj_tmp);
+    }
+
+    pyObj_tmp = PyLong_FromUnsignedLongLong(conn->hedged_reads_.load());
+    if (-1 == PyDict_SetItemString(pyObj_opts, "hedged_reads", pyObj_tmp)) {
+        PyErr_Print();
+        PyErr_Clear();
+    }
+    Py_XDECREF(pyObj_tmp);
+
+    pyObj_tmp = PyLong_FromUnsignedLongLong(conn->hedged_reads_won_.load());
+    if (-1 == PyDict_SetItemString(pyObj_opts, "hedged_reads_won", pyObj_tmp)) {
+        PyErr_Print();
+        PyErr_Clear();
+    }
+    Py_XDECREF(pyObj_tmp);
+
+    PyObject* pyObj_shards = PyList_New(static_cast<Py_ssize_t>(0));
+    for (const auto& shard : conn->shards_) {
+        PyObject* pyObj_shard = PyDict_New();
+        pyObj_tmp = PyLong_FromSize_t(shard->queue_depth_.load());
+        if (-1 == PyDict_SetItemString(pyObj_shard, "queue_depth", pyObj_tmp)) {
+            PyErr_Print();
+            PyErr_Clear();
+        }
+        Py_XDECREF(pyObj_tmp);
+
+        pyObj_tmp = PyLong_FromUnsignedLongLong(shard->completed_.load());
+        if (-1 == PyDict_SetItemString(pyObj_shard, "completed", pyObj_tmp)) {
+            PyErr_Print();
+            PyErr_Clear();
+        }
+        Py_XDECREF(pyObj_tmp);
+
+        if (-1 == PyList_Append(pyObj_shards, pyObj_shard)) {
+            PyErr_Print();
+            PyErr_Clear();
+        }
+        Py_XDECREF(pyObj_shard);
+    }
+
+    if (-1 == PyDict_SetItemString(pyObj_opts, "io_shards", pyObj_shards)) {
+        PyErr_Print();
+        PyErr_Clear();
+    }
+    Py_XDECREF(pyObj_shards);
+
+    PyObject* pyObj_read_caches = PyDict_New();
+    {
+        std::lock_guard<std::mutex> lock(conn->read_caches_mutex_);
+        for (const auto& [name, cache] : conn->read_caches_) {
+            PyObject* pyObj_cache = PyDict_New();
+            std::vector<std::pair<const char*, unsigned long long>> counters{
+                { "max_bytes", cache->max_bytes() },
+                { "ttl", static_cast<unsigned long long>(cache->ttl().count()) },
+                { "bytes", cache->bytes() },
+                { "entries", cache->entries() },
+                { "hits", cache->hits() },
+                { "misses", cache->misses() },
+                { "evictions", cache->evictions() },
+                { "revalidations", cache->revalidations() },
+            };
+            for (const auto& [counter, value] : counters) {
+                pyObj_tmp = PyLong_FromUnsignedLongLong(value);
+                if (-1 == PyDict_SetItemString(pyObj_cache, counter, pyObj_tmp)) {
+                    PyErr_Print();
+                    PyErr_Clear();
+                }
+                Py_XDECREF(pyObj_tmp);
+            }
+
+            if (-1 == PyDict_SetItemString(pyObj_read_caches, name.c_str(), pyObj_cache)) {
+                PyErr_Print();
+                PyErr_Clear();
+            }
+            Py_XDECREF(pyObj_cache);
+        }
+    }
+
+    if (-1 == PyDict_SetItemString(pyObj_opts, "read_caches", pyObj_read_caches)) {
+        PyErr_Print();
+        PyErr_Clear();
+    }
+    Py_XDECREF(pyObj_read_caches);
+
+    if (conn->prepared_cache_) {
+        auto& cache = conn->prepared_cache_;
+        pyObj_tmp = PyLong_FromSize_t(cache->capacity());
+        if (-1 == PyDict_SetItemString(pyObj_opts, "prepared_statement_cache_size", pyObj_tmp)) {
+            PyErr_Print();
+            PyErr_Clear();
+        }
+        Py_XDECREF(pyObj_tmp);
+
+        PyObject* pyObj_cache = PyDict_New();
+        std::vector<std::pair<const char*, unsigned long long>> counters{
+            { "capacity", cache->capacity() },
+            { "entries", cache->size() },
+            { "hits", cache->hits() },
+            { "misses", cache->misses() },
+            { "reprepares", cache->reprepares() },
+            { "evictions", cache->evictions() },
+            { "prepares", conn->prepares_in_flight_.sent() },
+            { "joined_prepares", conn->prepares_in_flight_.joined() },
+        };
+        for (const auto& [counter, value] : counters) {
+            pyObj_tmp = PyLong_FromUnsignedLongLong(value);
+            if (-1 == PyDict_SetItemString(pyObj_cache, counter, pyObj_tmp)) {
+                PyErr_Print();
+                PyErr_Clear();
+            }
+            Py_XDECREF(pyObj_tmp);
+        }
+        if (-1 == PyDict_SetItemString(pyObj_opts, "prepared_statement_cache", pyObj_cache)) {
+            PyErr_Print();
+            PyErr_Clear();
+        }
+        Py_XDECREF(pyObj_cache);
+    }
+
     auto credentials = cluster_info.second.credentials();
     PyObject* pyObj_creds = PyDict_New();
 
@@ -1188,15 +1434,12 @@ handle_close_connection([[maybe_unused]] PyObject* self, PyObject* args, PyObjec
     auto barrier = std::make_shared<std::promise<PyObject*>>();
     auto f = barrier->get_future();
     {
-        int callback_count = 0;
-        Py_BEGIN_ALLOW_THREADS conn->cluster_->close([pyObj_conn, pyObj_callback, pyObj_errback, callback_count, barrier]() mutable {
-            if (callback_count == 0) {
-                close_connection_callback(pyObj_conn, pyObj_callback, pyObj_errback, barrier);
-            } else {
-                CB_LOG_DEBUG("close callback called {} times already!", callback_count);
-                callback_count++;
-            }
-        });
+        Py_BEGIN_ALLOW_THREADS execute_on_all_clusters(
+          conn,
+          [](couchbase::core::cluster& cluster, auto&& handler) { cluster.close([handler]() mutable { handler({}); }); },
+          [pyObj_conn, pyObj_callback, pyObj_errback, barrier](std::error_code) {
+              close_connection_callback(pyObj_conn, pyObj_callback, pyObj_errback, barrier);
+          });
         Py_END_ALLOW_THREADS
     }
     if (nullptr == pyObj_callback || nullptr == pyObj_errback) {
@@ -1259,28 +1502,19 @@ handle_open_or_close_bucket([[maybe_unused]] PyObject* self, PyObject* args, PyO
     auto barrier = std::make_shared<std::promise<PyObject*>>();
     auto f = barrier->get_future();
     {
-        int callback_count = 0;
-        Py_BEGIN_ALLOW_THREADS if (open)
-        {
-            conn->cluster_->open_bucket(bucket_name,
-                                        [pyObj_callback, pyObj_errback, callback_count, open, barrier](std::error_code ec) mutable {
-                                            // @TODO: should the c++ client execute this lambda more than once?
-                                            if (callback_count == 0) {
-                                                bucket_op_callback(ec, open, pyObj_callback, pyObj_errback, barrier);
-                                            }
-                                            callback_count++;
-                                        });
-        }
-        else
-        {
-            conn->cluster_->close_bucket(bucket_name,
-                                         [pyObj_callback, pyObj_errback, callback_count, open, barrier](std::error_code ec) mutable {
-                                             if (callback_count == 0) {
-                                                 bucket_op_callback(ec, open, pyObj_callback, pyObj_errback, barrier);
-                                             }
-                                             callback_count++;
-                                         });
-        }
+        std::string bucket{ bucket_name };
+        Py_BEGIN_ALLOW_THREADS execute_on_all_clusters(
+          conn,
+          [&bucket, open](couchbase::core::cluster& cluster, auto&& handler) {
+              if (open) {
+                  cluster.open_bucket(bucket, std::move(handler));
+              } else {
+                  cluster.close_bucket(bucket, std::move(handler));
+              }
+          },
+          [pyObj_callback, pyObj_errback, open, barrier](std::error_code ec) {
+              bucket_op_callback(ec, open, pyObj_callback, pyObj_errback, barrier);
+          });
         Py_END_ALLOW_THREADS
     }
     if (nullptr == pyObj_callback || nullptr == pyObj_errback) {
@@ -1290,3 +1524,52 @@ handle_open_or_close_bucket([[maybe_unused]] PyObject* self, PyObject* args, PyO
     }
     Py_RETURN_NONE;
 }
+
+PyObject*
+handle_configure_read_cache([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kwargs)
+{
+    PyObject* pyObj_conn = nullptr;
+    char* bucket_name = nullptr;
+    char* scope_name = nullptr;
+    char* collection_name = nullptr;
+    unsigned long long max_bytes = 0;
+    unsigned long long ttl_ms = 0;
+    int revalidate = 0;
+
+    static const char* kw_list[] = { "", "bucket", "scope", "collection_name", "max_bytes", "ttl", "revalidate", nullptr };
+
+    const char* kw_format = "O!sss|KKp";
+    int ret = PyArg_ParseTupleAndKeywords(args,
+                                          kwargs,
+                                          kw_format,
+                                          const_cast<char**>(kw_list),
+                                          &PyCapsule_Type,
+                                          &pyObj_conn,
+                                          &bucket_name,
+                                          &scope_name,
+                                          &collection_name,
+                                          &max_bytes,
+                                          &ttl_ms,
+                                          &revalidate);
+
+    if (!ret) {
+        std::string msg = "Cannot configure read cache. Unable to parse args/kwargs.";
+        pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, msg.c_str());
+        return nullptr;
+    }
+
+    connection* conn = reinterpret_cast<connection*>(PyCapsule_GetPointer(pyObj_conn, "conn_"));
+    if (nullptr == conn) {
+        pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, NULL_CONN_OBJECT);
+        return nullptr;
+    }
+
+    // a max_bytes of 0 removes the collection's cache, entries already handed out are not affected
+    std::shared_ptr<read_cache> cache = nullptr;
+    if (max_bytes > 0) {
+        cache = std::make_shared<read_cache>(
+          static_cast<std::size_t>(max_bytes), std::chrono::milliseconds(ttl_ms), static_cast<bool>(revalidate));
+    }
+    conn->set_read_cache(connection::read_cache_name(bucket_name, scope_name, collection_name), std::move(cache));
+    Py_RETURN_NONE;
+}
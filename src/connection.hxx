@@ -30,3 +30,6 @@ handle_close_connection(PyObject* self, PyObject* args, PyObject* kwargs);
 
 PyObject*
 handle_open_or_close_bucket(PyObject* self, PyObject* args, PyObject* kwargs);
+
+PyObject*
+handle_configure_read_cache(PyObject* self, PyObject* args, PyObject* kwargs);
@@ -16,6 +16,9 @@
  */
 
 #include "diagnostics.hxx"
+#include <iterator>
+#include <mutex>
+#include <optional>
 
 template<typename T>
 void
@@ -294,6 +297,51 @@ create_diagnostics_op_response(const T& resp,
     PyGILState_Release(state);
 }
 
+template<typename Report>
+struct report_fan_in {
+    std::mutex mut;
+    std::size_t remaining;
+    std::optional<Report> report{};
+    std::function<void(Report)> handler;
+};
+
+/**
+ * Runs op (a ping or diagnostics report) against every cluster owned by the connection, each one holds
+ * connections of its own (see connection::clusters()).  handler is called once, w/ the endpoints of all
+ * reports merged into the first one that completed.
+ */
+template<typename Report, typename Operation>
+void
+report_on_all_clusters(connection* conn, Operation&& op, std::function<void(Report)> handler)
+{
+    auto clusters = conn->clusters();
+    auto state = std::make_shared<report_fan_in<Report>>();
+    state->remaining = clusters.size();
+    state->handler = std::move(handler);
+    for (auto& cluster : clusters) {
+        op(*cluster, [state](Report r) {
+            std::optional<Report> done{};
+            {
+                std::lock_guard<std::mutex> lock(state->mut);
+                if (!state->report) {
+                    state->report = std::move(r);
+                } else {
+                    for (auto& [service, endpoints] : r.services) {
+                        auto& merged = state->report->services[service];
+                        merged.insert(merged.end(), std::make_move_iterator(endpoints.begin()), std::make_move_iterator(endpoints.end()));
+                    }
+                }
+                if (--state->remaining == 0) {
+                    done = std::move(state->report);
+                }
+            }
+            if (done) {
+                state->handler(std::move(*done));
+            }
+        });
+    }
+}
+
 PyObject*
 handle_diagnostics_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kwargs)
 {
@@ -370,15 +418,20 @@ handle_diagnostics_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject*
     auto f = barrier->get_future();
 
     if (op_type == Operations::DIAGNOSTICS) {
-        Py_BEGIN_ALLOW_THREADS conn->cluster_->diagnostics(
-          reportId, [pyObj_callback, pyObj_errback, barrier](couchbase::core::diag::diagnostics_result r) {
+        Py_BEGIN_ALLOW_THREADS report_on_all_clusters<couchbase::core::diag::diagnostics_result>(
+          conn,
+          [&reportId](couchbase::core::cluster& cluster, auto&& handler) { cluster.diagnostics(reportId, std::move(handler)); },
+          [pyObj_callback, pyObj_errback, barrier](couchbase::core::diag::diagnostics_result r) {
               create_diagnostics_op_response(r, pyObj_callback, pyObj_errback, barrier);
           });
         Py_END_ALLOW_THREADS
     } else {
-        couchbase::core::diag::ping_result resp;
-        Py_BEGIN_ALLOW_THREADS conn->cluster_->ping(
-          reportId, bucketName, services, [pyObj_callback, pyObj_errback, barrier](couchbase::core::diag::ping_result r) {
+        Py_BEGIN_ALLOW_THREADS report_on_all_clusters<couchbase::core::diag::ping_result>(
+          conn,
+          [&reportId, &bucketName, &services](couchbase::core::cluster& cluster, auto&& handler) {
+              cluster.ping(reportId, bucketName, services, std::move(handler));
+          },
+          [pyObj_callback, pyObj_errback, barrier](couchbase::core::diag::ping_result r) {
               create_diagnostics_op_response(r, pyObj_callback, pyObj_errback, barrier);
           });
         Py_END_ALLOW_THREADS
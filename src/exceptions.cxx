@@ -42,6 +42,9 @@ exception_base__strerror__(exception_base* self, [[maybe_unused]] PyObject* args
 static PyObject*
 exception_base__context__(exception_base* self, [[maybe_unused]] PyObject* args)
 {
+    if (self->error_context == nullptr && self->lazy_context != nullptr) {
+        self->error_context = self->lazy_context->build_error_context();
+    }
     if (self->error_context) {
         PyObject* pyObj_error_context = PyDict_Copy(self->error_context);
         return pyObj_error_context;
@@ -52,6 +55,9 @@ exception_base__context__(exception_base* self, [[maybe_unused]] PyObject* args)
 static PyObject*
 exception_base__info__(exception_base* self, [[maybe_unused]] PyObject* args)
 {
+    if (self->exc_info == nullptr && self->lazy_context != nullptr) {
+        self->exc_info = self->lazy_context->build_exc_info();
+    }
     if (self->exc_info) {
         PyObject* pyObj_exc_info = PyDict_Copy(self->exc_info);
         return pyObj_exc_info;
@@ -59,6 +65,24 @@ exception_base__info__(exception_base* self, [[maybe_unused]] PyObject* args)
     Py_RETURN_NONE;
 }
 
+static PyObject*
+exception_base__context_type__(exception_base* self, [[maybe_unused]] PyObject* args)
+{
+    if (self->lazy_context != nullptr) {
+        return PyUnicode_FromString(self->lazy_context->context_type());
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject*
+exception_base__has_retry_reasons__(exception_base* self, [[maybe_unused]] PyObject* args)
+{
+    if (self->lazy_context != nullptr) {
+        return PyBool_FromLong(static_cast<long>(self->lazy_context->has_retry_reasons()));
+    }
+    Py_RETURN_NONE;
+}
+
 static void
 exception_base_dealloc(exception_base* self)
 {
@@ -74,6 +98,7 @@ exception_base_dealloc(exception_base* self)
         }
         Py_DECREF(self->exc_info);
     }
+    delete self->lazy_context;
     Py_TYPE(self)->tp_free((PyObject*)self);
     CB_LOG_DEBUG("{}: exception_base_dealloc completed", "PYCBC");
 }
@@ -103,6 +128,14 @@ static PyMethodDef exception_base_methods[] = {
     { "err_category", (PyCFunction)exception_base__category__, METH_NOARGS, PyDoc_STR("error category, expressed as a string") },
     { "error_context", (PyCFunction)exception_base__context__, METH_NOARGS, PyDoc_STR("error context dict") },
     { "error_info", (PyCFunction)exception_base__info__, METH_NOARGS, PyDoc_STR("error info dict") },
+    { "error_context_type",
+      (PyCFunction)exception_base__context_type__,
+      METH_NOARGS,
+      PyDoc_STR("context type of the error context, w/o building it (None if not known up front)") },
+    { "has_retry_reasons",
+      (PyCFunction)exception_base__has_retry_reasons__,
+      METH_NOARGS,
+      PyDoc_STR("whether the error context has retry reasons, w/o building it (None if not known up front)") },
     { nullptr, nullptr, 0, nullptr }
 };
 
@@ -313,6 +346,30 @@ build_kv_error_context(const couchbase::key_value_error_context& ctx, PyObject*
     }
 }
 
+PyObject*
+build_exception_info(const char* file, int line, const std::string& error_msg)
+{
+    PyObject* pyObj_exc_info = PyDict_New();
+
+    PyObject* pyObj_cinfo = Py_BuildValue("(s,i)", file, line);
+    if (-1 == PyDict_SetItemString(pyObj_exc_info, "cinfo", pyObj_cinfo)) {
+        PyErr_Print();
+        Py_XDECREF(pyObj_cinfo);
+    }
+    Py_DECREF(pyObj_cinfo);
+
+    if (!error_msg.empty()) {
+        PyObject* pyObj_error_msg = PyUnicode_FromString(error_msg.c_str());
+        if (-1 == PyDict_SetItemString(pyObj_exc_info, "error_message", pyObj_error_msg)) {
+            PyErr_Print();
+            Py_XDECREF(pyObj_error_msg);
+        }
+        Py_DECREF(pyObj_error_msg);
+    }
+
+    return pyObj_exc_info;
+}
+
 struct PycbcErrorCategory : std::error_category {
     const char* name() const noexcept override;
     std::string message(int ec) const override;
@@ -533,6 +590,9 @@ pycbc_add_exception_info(PyObject* pyObj_exc_base, const char* key, PyObject* py
 {
     exception_base* exc = reinterpret_cast<exception_base*>(pyObj_exc_base);
 
+    if (exc->exc_info == nullptr && exc->lazy_context != nullptr) {
+        exc->exc_info = exc->lazy_context->build_exc_info();
+    }
     if (exc->exc_info) {
         if (-1 == PyDict_SetItemString(exc->exc_info, key, pyObj_value)) {
             PyErr_Print();
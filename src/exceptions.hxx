@@ -68,10 +68,33 @@
 
 #define NULL_CONN_OBJECT "Received a null connection."
 
+class lazy_error_context;
+
 struct exception_base {
     PyObject_HEAD std::error_code ec;
     PyObject* error_context = nullptr;
     PyObject* exc_info = nullptr;
+    // C++ error context error_context/exc_info are built from on first access, owned by the exception
+    lazy_error_context* lazy_context = nullptr;
+};
+
+/**
+ * Keeps an error context in its C++ form so the Python dicts for error_context() and error_info() are only
+ * built if they are asked for.  Most KV failures (e.g. document_not_found on a cache-aside get) are mapped to
+ * an exception class and handled w/o ever looking at the context.  Only ever used w/ the GIL held.
+ */
+class lazy_error_context
+{
+  public:
+    virtual ~lazy_error_context() = default;
+
+    // both return a new reference
+    virtual PyObject* build_error_context() = 0;
+    virtual PyObject* build_exc_info() = 0;
+
+    // value of CONTEXT_TYPE in the error context
+    virtual const char* context_type() const = 0;
+    virtual bool has_retry_reasons() const = 0;
 };
 
 int
@@ -110,6 +133,10 @@ build_kv_error_map_info(couchbase::key_value_error_map_info error_info);
 void
 build_kv_error_context(const couchbase::key_value_error_context& ctx, PyObject* pyObj_ctx);
 
+// the exc_info dict shared by the error context based exceptions (cinfo + error_message), returns a new reference
+PyObject*
+build_exception_info(const char* file, int line, const std::string& error_msg);
+
 /*
 
 Build exceptions via error context
@@ -223,6 +250,58 @@ build_base_error_context_new(const Context& ctx)
     return pyObj_error_context;
 }
 
+template<typename Context>
+class lazy_kv_error_context : public lazy_error_context
+{
+  public:
+    lazy_kv_error_context(const Context& ctx, const char* context_type, const char* file, int line, std::string error_msg)
+      : ctx_(ctx)
+      , context_type_(context_type)
+      , file_(file)
+      , line_(line)
+      , error_msg_(std::move(error_msg))
+    {
+    }
+
+    PyObject* build_error_context() override
+    {
+        PyObject* pyObj_error_context = build_base_error_context_new(ctx_);
+
+        build_kv_error_context(ctx_, pyObj_error_context);
+
+        PyObject* pyObj_tmp = PyUnicode_FromString(context_type_);
+        if (-1 == PyDict_SetItemString(pyObj_error_context, CONTEXT_TYPE, pyObj_tmp)) {
+            PyErr_Print();
+            PyErr_Clear();
+        }
+        Py_DECREF(pyObj_tmp);
+        return pyObj_error_context;
+    }
+
+    PyObject* build_exc_info() override
+    {
+        return build_exception_info(file_, line_, error_msg_);
+    }
+
+    const char* context_type() const override
+    {
+        return context_type_;
+    }
+
+    bool has_retry_reasons() const override
+    {
+        return !ctx_.retry_reasons().empty();
+    }
+
+  private:
+    Context ctx_;
+    const char* context_type_;
+    // __FILE__ of the caller, a string literal
+    const char* file_;
+    int line_;
+    std::string error_msg_;
+};
+
 template<typename T>
 void
 build_base_http_error_context(const T& ctx, PyObject* pyObj_error_context)
@@ -285,43 +364,12 @@ build_exception_from_context(const couchbase::key_value_error_context& ctx,
                              const char* file,
                              int line,
                              std::string error_msg,
-                             std::string context_detail_type)
+                             [[maybe_unused]] std::string context_detail_type)
 {
     exception_base* exc = create_exception_base_obj();
     exc->ec = ctx.ec();
-    PyObject* pyObj_error_context = build_base_error_context_new(ctx);
-
-    build_kv_error_context(ctx, pyObj_error_context);
-
-    std::string context_type = "KeyValueErrorContext";
-    PyObject* pyObj_tmp = PyUnicode_FromString(context_type.c_str());
-    if (-1 == PyDict_SetItemString(pyObj_error_context, CONTEXT_TYPE, pyObj_tmp)) {
-        PyErr_Print();
-        PyErr_Clear();
-    }
-    Py_DECREF(pyObj_tmp);
-
-    exc->error_context = pyObj_error_context;
-
-    PyObject* pyObj_exc_info = PyDict_New();
-
-    PyObject* pyObj_cinfo = Py_BuildValue("(s,i)", file, line);
-    if (-1 == PyDict_SetItemString(pyObj_exc_info, "cinfo", pyObj_cinfo)) {
-        PyErr_Print();
-        Py_XDECREF(pyObj_cinfo);
-    }
-    Py_DECREF(pyObj_cinfo);
-
-    if (!error_msg.empty()) {
-        PyObject* pyObj_error_msg = PyUnicode_FromString(error_msg.c_str());
-        if (-1 == PyDict_SetItemString(pyObj_exc_info, "error_message", pyObj_error_msg)) {
-            PyErr_Print();
-            Py_XDECREF(pyObj_error_msg);
-        }
-        Py_DECREF(pyObj_error_msg);
-    }
-
-    exc->exc_info = pyObj_exc_info;
+    exc->lazy_context =
+      new lazy_kv_error_context<couchbase::key_value_error_context>(ctx, "KeyValueErrorContext", file, line, std::move(error_msg));
 
     return reinterpret_cast<PyObject*>(exc);
 }
@@ -415,43 +463,12 @@ build_exception_from_context(const couchbase::subdocument_error_context& ctx,
                              const char* file,
                              int line,
                              std::string error_msg,
-                             std::string context_detail_type)
+                             [[maybe_unused]] std::string context_detail_type)
 {
     exception_base* exc = create_exception_base_obj();
     exc->ec = ctx.ec();
-    PyObject* pyObj_error_context = build_base_error_context_new(ctx);
-
-    build_kv_error_context(ctx, pyObj_error_context);
-
-    std::string context_type = "SubdocumentErrorContext";
-    PyObject* pyObj_tmp = PyUnicode_FromString(context_type.c_str());
-    if (-1 == PyDict_SetItemString(pyObj_error_context, CONTEXT_TYPE, pyObj_tmp)) {
-        PyErr_Print();
-        PyErr_Clear();
-    }
-    Py_DECREF(pyObj_tmp);
-
-    exc->error_context = pyObj_error_context;
-
-    PyObject* pyObj_exc_info = PyDict_New();
-
-    PyObject* pyObj_cinfo = Py_BuildValue("(s,i)", file, line);
-    if (-1 == PyDict_SetItemString(pyObj_exc_info, "cinfo", pyObj_cinfo)) {
-        PyErr_Print();
-        Py_XDECREF(pyObj_cinfo);
-    }
-    Py_DECREF(pyObj_cinfo);
-
-    if (!error_msg.empty()) {
-        PyObject* pyObj_error_msg = PyUnicode_FromString(error_msg.c_str());
-        if (-1 == PyDict_SetItemString(pyObj_exc_info, "error_message", pyObj_error_msg)) {
-            PyErr_Print();
-            Py_XDECREF(pyObj_error_msg);
-        }
-        Py_DECREF(pyObj_error_msg);
-    }
-
-    exc->exc_info = pyObj_exc_info;
+    exc->lazy_context =
+      new lazy_kv_error_context<couchbase::subdocument_error_context>(ctx, "SubdocumentErrorContext", file, line, std::move(error_msg));
 
     return reinterpret_cast<PyObject*>(exc);
 }
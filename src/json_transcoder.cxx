@@ -0,0 +1,825 @@
+/*
+ *   Copyright 2016-2022. Couchbase, Inc.
+ *   All Rights Reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include "json_transcoder.hxx"
+#include <charconv>
+#include <cmath>
+#include <string>
+
+namespace
+{
+using couchbase::core::utils::binary;
+
+void
+append(binary& out, const char* data, std::size_t size)
+{
+    auto* begin = reinterpret_cast<const std::byte*>(data);
+    out.insert(out.end(), begin, begin + size);
+}
+
+void
+append(binary& out, char c)
+{
+    out.push_back(static_cast<std::byte>(c));
+}
+
+bool
+encode_str(PyObject* obj, binary& out)
+{
+    static constexpr char hex[] = "0123456789abcdef";
+    Py_ssize_t size = 0;
+    const char* data = PyUnicode_AsUTF8AndSize(obj, &size);
+    if (data == nullptr) {
+        return false;
+    }
+
+    append(out, '"');
+    // copy runs of characters that don't need escaping in one go
+    const char* run = data;
+    for (Py_ssize_t i = 0; i < size; i++) {
+        auto c = static_cast<unsigned char>(data[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        append(out, run, static_cast<std::size_t>(data + i - run));
+        run = data + i + 1;
+        switch (c) {
+            case '"':
+                append(out, "\\\"", 2);
+                break;
+            case '\\':
+                append(out, "\\\\", 2);
+                break;
+            case '\n':
+                append(out, "\\n", 2);
+                break;
+            case '\r':
+                append(out, "\\r", 2);
+                break;
+            case '\t':
+                append(out, "\\t", 2);
+                break;
+            case '\b':
+                append(out, "\\b", 2);
+                break;
+            case '\f':
+                append(out, "\\f", 2);
+                break;
+            default: {
+                const char escaped[] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF] };
+                append(out, escaped, sizeof(escaped));
+                break;
+            }
+        }
+    }
+    append(out, run, static_cast<std::size_t>(data + size - run));
+    append(out, '"');
+    return true;
+}
+
+bool
+encode_long(PyObject* obj, binary& out)
+{
+    int overflow = 0;
+    long long value = PyLong_AsLongLongAndOverflow(obj, &overflow);
+    if (overflow == 0) {
+        if (value == -1 && PyErr_Occurred() != nullptr) {
+            return false;
+        }
+        char buf[24];
+        auto res = std::to_chars(buf, buf + sizeof(buf), value);
+        append(out, buf, static_cast<std::size_t>(res.ptr - buf));
+        return true;
+    }
+
+    // same as json, use int's repr so IntEnum and friends are written as numbers
+    PyObject* pyObj_repr = PyLong_Type.tp_repr(obj);
+    if (pyObj_repr == nullptr) {
+        return false;
+    }
+    Py_ssize_t size = 0;
+    const char* data = PyUnicode_AsUTF8AndSize(pyObj_repr, &size);
+    if (data != nullptr) {
+        append(out, data, static_cast<std::size_t>(size));
+    }
+    Py_DECREF(pyObj_repr);
+    return data != nullptr;
+}
+
+bool
+encode_float(PyObject* obj, binary& out)
+{
+    double value = PyFloat_AS_DOUBLE(obj);
+    if (std::isnan(value)) {
+        append(out, "NaN", 3);
+        return true;
+    }
+    if (std::isinf(value)) {
+        if (value > 0) {
+            append(out, "Infinity", 8);
+        } else {
+            append(out, "-Infinity", 9);
+        }
+        return true;
+    }
+    // matches float.__repr__
+    char* repr = PyOS_double_to_string(value, 'r', 0, Py_DTSF_ADD_DOT_0, nullptr);
+    if (repr == nullptr) {
+        return false;
+    }
+    append(out, repr, std::char_traits<char>::length(repr));
+    PyMem_Free(repr);
+    return true;
+}
+
+bool
+encode_key(PyObject* key, binary& out)
+{
+    if (PyUnicode_Check(key)) {
+        return encode_str(key, out);
+    }
+    if (key == Py_True) {
+        append(out, "\"true\"", 6);
+        return true;
+    }
+    if (key == Py_False) {
+        append(out, "\"false\"", 7);
+        return true;
+    }
+    if (key == Py_None) {
+        append(out, "\"null\"", 6);
+        return true;
+    }
+    if (PyLong_Check(key) || PyFloat_Check(key)) {
+        append(out, '"');
+        if (!(PyLong_Check(key) ? encode_long(key, out) : encode_float(key, out))) {
+            return false;
+        }
+        append(out, '"');
+        return true;
+    }
+    PyErr_Format(PyExc_TypeError, "keys must be str, int, float, bool or None, not %.100s", Py_TYPE(key)->tp_name);
+    return false;
+}
+
+bool
+encode_json_value(PyObject* obj, binary& out);
+
+bool
+encode_dict(PyObject* obj, binary& out)
+{
+    PyObject* key = nullptr;
+    PyObject* value = nullptr;
+    Py_ssize_t pos = 0;
+    bool first = true;
+
+    append(out, '{');
+    while (PyDict_Next(obj, &pos, &key, &value)) {
+        if (!first) {
+            append(out, ',');
+        }
+        first = false;
+        if (!encode_key(key, out)) {
+            return false;
+        }
+        append(out, ':');
+        if (!encode_json_value(value, out)) {
+            return false;
+        }
+    }
+    append(out, '}');
+    return true;
+}
+
+bool
+encode_sequence(PyObject* obj, binary& out)
+{
+    bool is_list = PyList_Check(obj);
+    Py_ssize_t size = is_list ? PyList_GET_SIZE(obj) : PyTuple_GET_SIZE(obj);
+
+    append(out, '[');
+    for (Py_ssize_t i = 0; i < size; i++) {
+        if (i > 0) {
+            append(out, ',');
+        }
+        if (!encode_json_value(is_list ? PyList_GET_ITEM(obj, i) : PyTuple_GET_ITEM(obj, i), out)) {
+            return false;
+        }
+    }
+    append(out, ']');
+    return true;
+}
+
+bool
+encode_json_value(PyObject* obj, binary& out)
+{
+    if (PyUnicode_Check(obj)) {
+        return encode_str(obj, out);
+    }
+    if (obj == Py_None) {
+        append(out, "null", 4);
+        return true;
+    }
+    if (obj == Py_True) {
+        append(out, "true", 4);
+        return true;
+    }
+    if (obj == Py_False) {
+        append(out, "false", 5);
+        return true;
+    }
+    if (PyLong_Check(obj)) {
+        return encode_long(obj, out);
+    }
+    if (PyFloat_Check(obj)) {
+        return encode_float(obj, out);
+    }
+
+    bool is_dict = PyDict_Check(obj);
+    if (!is_dict && !PyList_Check(obj) && !PyTuple_Check(obj)) {
+        PyErr_Format(PyExc_TypeError, "Object of type %.100s is not JSON serializable", Py_TYPE(obj)->tp_name);
+        return false;
+    }
+    // also catches circular references
+    if (Py_EnterRecursiveCall(" while encoding a JSON object")) {
+        return false;
+    }
+    bool res = is_dict ? encode_dict(obj, out) : encode_sequence(obj, out);
+    Py_LeaveRecursiveCall();
+    return res;
+}
+
+class tape_parser
+{
+  public:
+    // Python's default recursion limit is in the same ballpark, deeper documents fail w/ a RecursionError
+    static constexpr std::size_t max_depth = 1000;
+
+    tape_parser(const char* data, std::size_t size, std::vector<json_tape::node>& nodes, std::string& arena)
+      : begin_{ data }
+      , pos_{ data }
+      , end_{ data + size }
+      , nodes_{ nodes }
+      , arena_{ arena }
+    {
+    }
+
+    bool parse()
+    {
+        if (!parse_value(0)) {
+            return false;
+        }
+        skip_whitespace();
+        if (pos_ != end_) {
+            return set_error("Extra data");
+        }
+        return true;
+    }
+
+    const std::string& error() const
+    {
+        return error_;
+    }
+
+    bool too_deep() const
+    {
+        return too_deep_;
+    }
+
+  private:
+    bool set_error(const char* msg)
+    {
+        error_ = std::string{ msg } + ": char " + std::to_string(pos_ - begin_);
+        return false;
+    }
+
+    void push(json_tape::kind type, std::uint32_t length = 0, std::int64_t value = 0)
+    {
+        nodes_.push_back({ type, length, value });
+    }
+
+    // stores [start, end) in the arena, the node refers to it by offset
+    void push_text(json_tape::kind type, const char* start, const char* end)
+    {
+        push(type, static_cast<std::uint32_t>(end - start), static_cast<std::int64_t>(arena_.size()));
+        arena_.append(start, end);
+    }
+
+    void skip_whitespace()
+    {
+        while (pos_ != end_ && (*pos_ == ' ' || *pos_ == '\t' || *pos_ == '\n' || *pos_ == '\r')) {
+            pos_++;
+        }
+    }
+
+    bool consume(const char* literal, std::size_t size)
+    {
+        if (static_cast<std::size_t>(end_ - pos_) < size || std::char_traits<char>::compare(pos_, literal, size) != 0) {
+            return false;
+        }
+        pos_ += size;
+        return true;
+    }
+
+    bool parse_literal(const char* literal, std::size_t size, json_tape::kind type)
+    {
+        if (!consume(literal, size)) {
+            return set_error("Expecting value");
+        }
+        push(type);
+        return true;
+    }
+
+    bool parse_value(std::size_t depth)
+    {
+        skip_whitespace();
+        if (pos_ == end_) {
+            return set_error("Expecting value");
+        }
+        switch (*pos_) {
+            case '{':
+            case '[':
+                if (depth >= max_depth) {
+                    too_deep_ = true;
+                    return set_error("Maximum nesting depth exceeded");
+                }
+                return *pos_ == '{' ? parse_object(depth + 1) : parse_array(depth + 1);
+            case '"':
+                return parse_string(json_tape::kind::string);
+            case 't':
+                return parse_literal("true", 4, json_tape::kind::true_value);
+            case 'f':
+                return parse_literal("false", 5, json_tape::kind::false_value);
+            case 'n':
+                return parse_literal("null", 4, json_tape::kind::null_value);
+            case 'N':
+                return parse_literal("NaN", 3, json_tape::kind::nan);
+            case 'I':
+                return parse_literal("Infinity", 8, json_tape::kind::positive_infinity);
+            case '-':
+                if (consume("-Infinity", 9)) {
+                    push(json_tape::kind::negative_infinity);
+                    return true;
+                }
+                return parse_number();
+            default:
+                if (*pos_ >= '0' && *pos_ <= '9') {
+                    return parse_number();
+                }
+                return set_error("Expecting value");
+        }
+    }
+
+    bool parse_number()
+    {
+        const char* start = pos_;
+        bool is_float = false;
+
+        if (*pos_ == '-') {
+            pos_++;
+        }
+        if (pos_ == end_ || *pos_ < '0' || *pos_ > '9') {
+            pos_ = start;
+            return set_error("Expecting value");
+        }
+        if (*pos_ == '0') {
+            pos_++;
+        } else {
+            while (pos_ != end_ && *pos_ >= '0' && *pos_ <= '9') {
+                pos_++;
+            }
+        }
+        if (pos_ + 1 < end_ && *pos_ == '.' && pos_[1] >= '0' && pos_[1] <= '9') {
+            is_float = true;
+            pos_ += 2;
+            while (pos_ != end_ && *pos_ >= '0' && *pos_ <= '9') {
+                pos_++;
+            }
+        }
+        if (pos_ != end_ && (*pos_ == 'e' || *pos_ == 'E')) {
+            const char* exp = pos_++;
+            if (pos_ != end_ && (*pos_ == '+' || *pos_ == '-')) {
+                pos_++;
+            }
+            if (pos_ == end_ || *pos_ < '0' || *pos_ > '9') {
+                // not an exponent after all, leave it for the caller to reject
+                pos_ = exp;
+            } else {
+                is_float = true;
+                while (pos_ != end_ && *pos_ >= '0' && *pos_ <= '9') {
+                    pos_++;
+                }
+            }
+        }
+
+        if (is_float) {
+            // converted by Python when materializing so the result matches float()
+            push_text(json_tape::kind::floating, start, pos_);
+            return true;
+        }
+        std::int64_t value = 0;
+        auto res = std::from_chars(start, pos_, value);
+        if (res.ec == std::errc{} && res.ptr == pos_) {
+            push(json_tape::kind::integer, 0, value);
+        } else {
+            push_text(json_tape::kind::big_integer, start, pos_);
+        }
+        return true;
+    }
+
+    bool parse_hex4(unsigned int& code_point)
+    {
+        if (end_ - pos_ < 4) {
+            return false;
+        }
+        code_point = 0;
+        for (int i = 0; i < 4; i++) {
+            char c = *pos_++;
+            code_point <<= 4;
+            if (c >= '0' && c <= '9') {
+                code_point |= static_cast<unsigned int>(c - '0');
+            } else if (c >= 'a' && c <= 'f') {
+                code_point |= static_cast<unsigned int>(c - 'a' + 10);
+            } else if (c >= 'A' && c <= 'F') {
+                code_point |= static_cast<unsigned int>(c - 'A' + 10);
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void append_utf8(unsigned int code_point)
+    {
+        if (code_point < 0x80) {
+            arena_.push_back(static_cast<char>(code_point));
+        } else if (code_point < 0x800) {
+            arena_.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+            arena_.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+        } else if (code_point < 0x10000) {
+            arena_.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+            arena_.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+            arena_.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+        } else {
+            arena_.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+            arena_.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+            arena_.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+            arena_.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+        }
+    }
+
+    bool parse_string(json_tape::kind type)
+    {
+        // skip the opening quote
+        const char* start = ++pos_;
+        while (pos_ != end_ && *pos_ != '"' && *pos_ != '\\' && static_cast<unsigned char>(*pos_) >= 0x20) {
+            pos_++;
+        }
+        if (pos_ != end_ && *pos_ == '"') {
+            // common case, nothing to unescape
+            push_text(type, start, pos_++);
+            return true;
+        }
+
+        std::size_t offset = arena_.size();
+        bool has_surrogates = false;
+        arena_.append(start, pos_);
+        while (pos_ != end_ && *pos_ != '"') {
+            auto c = static_cast<unsigned char>(*pos_);
+            if (c < 0x20) {
+                return set_error("Invalid control character");
+            }
+            if (c != '\\') {
+                arena_.push_back(*pos_++);
+                continue;
+            }
+            if (++pos_ == end_) {
+                break;
+            }
+            switch (*pos_++) {
+                case '"':
+                    arena_.push_back('"');
+                    break;
+                case '\\':
+                    arena_.push_back('\\');
+                    break;
+                case '/':
+                    arena_.push_back('/');
+                    break;
+                case 'b':
+                    arena_.push_back('\b');
+                    break;
+                case 'f':
+                    arena_.push_back('\f');
+                    break;
+                case 'n':
+                    arena_.push_back('\n');
+                    break;
+                case 'r':
+                    arena_.push_back('\r');
+                    break;
+                case 't':
+                    arena_.push_back('\t');
+                    break;
+                case 'u': {
+                    unsigned int code_point = 0;
+                    if (!parse_hex4(code_point)) {
+                        return set_error("Invalid \\uXXXX escape");
+                    }
+                    // combine surrogate pairs, lone surrogates are kept as is (like json.loads)
+                    if (code_point >= 0xD800 && code_point <= 0xDBFF && end_ - pos_ >= 6 && pos_[0] == '\\' && pos_[1] == 'u') {
+                        const char* next = pos_;
+                        pos_ += 2;
+                        unsigned int low = 0;
+                        if (parse_hex4(low) && low >= 0xDC00 && low <= 0xDFFF) {
+                            code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+                        } else {
+                            pos_ = next;
+                        }
+                    }
+                    has_surrogates = has_surrogates || (code_point >= 0xD800 && code_point <= 0xDFFF);
+                    append_utf8(code_point);
+                    break;
+                }
+                default:
+                    pos_--;
+                    return set_error("Invalid \\escape");
+            }
+        }
+        if (pos_ == end_) {
+            return set_error("Unterminated string");
+        }
+        pos_++;
+        if (has_surrogates) {
+            type = type == json_tape::kind::key ? json_tape::kind::key_with_surrogates : json_tape::kind::string_with_surrogates;
+        }
+        push(type, static_cast<std::uint32_t>(arena_.size() - offset), static_cast<std::int64_t>(offset));
+        return true;
+    }
+
+    bool parse_object(std::size_t depth)
+    {
+        // the member count is patched in once the object is closed
+        std::size_t index = nodes_.size();
+        push(json_tape::kind::object);
+        std::uint32_t count = 0;
+
+        // skip the opening brace
+        pos_++;
+        skip_whitespace();
+        if (pos_ != end_ && *pos_ == '}') {
+            pos_++;
+            return true;
+        }
+        while (true) {
+            skip_whitespace();
+            if (pos_ == end_ || *pos_ != '"') {
+                return set_error("Expecting property name enclosed in double quotes");
+            }
+            if (!parse_string(json_tape::kind::key)) {
+                return false;
+            }
+            skip_whitespace();
+            if (pos_ == end_ || *pos_ != ':') {
+                return set_error("Expecting ':' delimiter");
+            }
+            pos_++;
+            if (!parse_value(depth)) {
+                return false;
+            }
+            nodes_[index].length = ++count;
+            skip_whitespace();
+            if (pos_ != end_ && *pos_ == ',') {
+                pos_++;
+                continue;
+            }
+            if (pos_ != end_ && *pos_ == '}') {
+                pos_++;
+                return true;
+            }
+            return set_error("Expecting ',' delimiter");
+        }
+    }
+
+    bool parse_array(std::size_t depth)
+    {
+        std::size_t index = nodes_.size();
+        push(json_tape::kind::array);
+        std::uint32_t count = 0;
+
+        // skip the opening bracket
+        pos_++;
+        skip_whitespace();
+        if (pos_ != end_ && *pos_ == ']') {
+            pos_++;
+            return true;
+        }
+        while (true) {
+            if (!parse_value(depth)) {
+                return false;
+            }
+            nodes_[index].length = ++count;
+            skip_whitespace();
+            if (pos_ != end_ && *pos_ == ',') {
+                pos_++;
+                continue;
+            }
+            if (pos_ != end_ && *pos_ == ']') {
+                pos_++;
+                return true;
+            }
+            return set_error("Expecting ',' delimiter");
+        }
+    }
+
+    const char* begin_;
+    const char* pos_;
+    const char* end_;
+    std::vector<json_tape::node>& nodes_;
+    std::string& arena_;
+    std::string error_{};
+    bool too_deep_{ false };
+};
+} // namespace
+
+bool
+pycbc_json_encode(PyObject* obj, couchbase::core::utils::binary& out)
+{
+    return encode_json_value(obj, out);
+}
+
+bool
+json_tape::parse(const char* data, std::size_t size)
+{
+    nodes_.clear();
+    arena_.clear();
+    // the arena never needs more than the document itself
+    arena_.reserve(size);
+    tape_parser parser{ data, size, nodes_, arena_ };
+    valid_ = parser.parse();
+    too_deep_ = parser.too_deep();
+    error_ = parser.error();
+    parsed_ = true;
+    return valid_;
+}
+
+bool
+json_tape::parse(const couchbase::core::utils::binary& value)
+{
+    return parse(reinterpret_cast<const char*>(value.data()), value.size());
+}
+
+PyObject*
+json_tape::materialize() const
+{
+    if (!valid_) {
+        PyErr_SetString(too_deep_ ? PyExc_RecursionError : PyExc_ValueError, error_.c_str());
+        return nullptr;
+    }
+    std::size_t index = 0;
+    PyObject* pyObj_key_memo = nullptr;
+    PyObject* pyObj_value = materialize_node(index, pyObj_key_memo);
+    Py_XDECREF(pyObj_key_memo);
+    return pyObj_value;
+}
+
+PyObject*
+json_tape::materialize_string(const node& n) const
+{
+    bool surrogates = n.type == kind::string_with_surrogates || n.type == kind::key_with_surrogates;
+    return PyUnicode_DecodeUTF8(arena_.data() + n.value, static_cast<Py_ssize_t>(n.length), surrogates ? "surrogatepass" : "strict");
+}
+
+PyObject*
+json_tape::materialize_node(std::size_t& index, PyObject*& pyObj_key_memo) const
+{
+    const node& n = nodes_[index++];
+    switch (n.type) {
+        case kind::null_value:
+            Py_RETURN_NONE;
+        case kind::true_value:
+            Py_RETURN_TRUE;
+        case kind::false_value:
+            Py_RETURN_FALSE;
+        case kind::nan:
+            return PyFloat_FromDouble(std::nan(""));
+        case kind::positive_infinity:
+            return PyFloat_FromDouble(HUGE_VAL);
+        case kind::negative_infinity:
+            return PyFloat_FromDouble(-HUGE_VAL);
+        case kind::integer:
+            return PyLong_FromLongLong(n.value);
+        case kind::big_integer: {
+            std::string digits{ arena_.data() + n.value, n.length };
+            return PyLong_FromString(digits.c_str(), nullptr, 10);
+        }
+        case kind::floating: {
+            std::string number{ arena_.data() + n.value, n.length };
+            double value = PyOS_string_to_double(number.c_str(), nullptr, nullptr);
+            if (value == -1.0 && PyErr_Occurred() != nullptr) {
+                return nullptr;
+            }
+            return PyFloat_FromDouble(value);
+        }
+        case kind::string:
+        case kind::string_with_surrogates:
+            return materialize_string(n);
+        case kind::key:
+        case kind::key_with_surrogates: {
+            PyObject* pyObj_key = materialize_string(n);
+            if (pyObj_key == nullptr) {
+                return nullptr;
+            }
+            // documents commonly repeat the same keys (e.g. arrays of objects), share a single str per key
+            if (pyObj_key_memo == nullptr && (pyObj_key_memo = PyDict_New()) == nullptr) {
+                Py_DECREF(pyObj_key);
+                return nullptr;
+            }
+            PyObject* pyObj_memo_key = PyDict_SetDefault(pyObj_key_memo, pyObj_key, pyObj_key);
+            Py_XINCREF(pyObj_memo_key);
+            Py_DECREF(pyObj_key);
+            return pyObj_memo_key;
+        }
+        case kind::array:
+        case kind::object:
+            break;
+    }
+
+    if (Py_EnterRecursiveCall(" while decoding a JSON document")) {
+        return nullptr;
+    }
+    PyObject* pyObj_container = nullptr;
+    if (n.type == kind::array) {
+        pyObj_container = PyList_New(static_cast<Py_ssize_t>(n.length));
+        for (std::uint32_t i = 0; pyObj_container != nullptr && i < n.length; i++) {
+            PyObject* pyObj_item = materialize_node(index, pyObj_key_memo);
+            if (pyObj_item == nullptr) {
+                Py_CLEAR(pyObj_container);
+                break;
+            }
+            PyList_SET_ITEM(pyObj_container, static_cast<Py_ssize_t>(i), pyObj_item);
+        }
+    } else {
+        pyObj_container = PyDict_New();
+        for (std::uint32_t i = 0; pyObj_container != nullptr && i < n.length; i++) {
+            PyObject* pyObj_key = materialize_node(index, pyObj_key_memo);
+            PyObject* pyObj_item = pyObj_key == nullptr ? nullptr : materialize_node(index, pyObj_key_memo);
+            if (pyObj_item == nullptr || -1 == PyDict_SetItem(pyObj_container, pyObj_key, pyObj_item)) {
+                Py_CLEAR(pyObj_container);
+            }
+            Py_XDECREF(pyObj_key);
+            Py_XDECREF(pyObj_item);
+        }
+    }
+    Py_LeaveRecursiveCall();
+    return pyObj_container;
+}
+
+PyObject*
+pycbc_json_decode(const char* data, std::size_t size)
+{
+    json_tape tape{};
+    tape.parse(data, size);
+    return tape.materialize();
+}
+
+PyObject*
+pycbc_json_encode_method([[maybe_unused]] PyObject* self, PyObject* args)
+{
+    PyObject* pyObj_value = nullptr;
+    if (!PyArg_ParseTuple(args, "O", &pyObj_value)) {
+        return nullptr;
+    }
+    couchbase::core::utils::binary out{};
+    if (!pycbc_json_encode(pyObj_value, out)) {
+        return nullptr;
+    }
+    return PyBytes_FromStringAndSize(reinterpret_cast<const char*>(out.data()), static_cast<Py_ssize_t>(out.size()));
+}
+
+PyObject*
+pycbc_json_decode_method([[maybe_unused]] PyObject* self, PyObject* args)
+{
+    Py_buffer buffer{};
+    // accepts str as well as any bytes-like object
+    if (!PyArg_ParseTuple(args, "s*", &buffer)) {
+        return nullptr;
+    }
+    PyObject* pyObj_value = pycbc_json_decode(static_cast<const char*>(buffer.buf), static_cast<std::size_t>(buffer.len));
+    PyBuffer_Release(&buffer);
+    return pyObj_value;
+}
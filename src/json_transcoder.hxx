@@ -0,0 +1,118 @@
+/*
+ *   Copyright 2016-2022. Couchbase, Inc.
+ *   All Rights Reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#pragma once
+
+// NOLINTNEXTLINE
+#include "Python.h" // NOLINT
+#include <core/utils/binary.hxx>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Native JSON transcoding between Python objects and the wire representation, avoiding the round trips
+ * through Python's json module (and the bytes -> str -> std::string copies that come with them).
+ *
+ * Supports dict (str, int, float, bool and None keys), list, tuple, str, int, float, bool and None, and
+ * produces/accepts the same documents as json.dumps(ensure_ascii=False)/json.loads.  Must be called with
+ * the GIL held.
+ */
+
+// appends the JSON representation of obj to out, returns false w/ a Python exception set on failure
+bool
+pycbc_json_encode(PyObject* obj, couchbase::core::utils::binary& out);
+
+// returns a new reference, or nullptr w/ a ValueError set if the document is not valid JSON
+PyObject*
+pycbc_json_decode(const char* data, std::size_t size);
+
+/**
+ * Decoding is split in two phases: parse() validates the document and flattens it into a compact tape of
+ * nodes (plus an arena w/ the unescaped strings and number literals) without touching the Python API, so it
+ * can run on an IO thread w/o the GIL.  materialize() then only has to create the Python objects.
+ */
+class json_tape
+{
+  public:
+    enum class kind : std::uint8_t {
+        null_value,
+        true_value,
+        false_value,
+        nan,
+        positive_infinity,
+        negative_infinity,
+        integer,
+        big_integer,
+        floating,
+        string,
+        string_with_surrogates,
+        key,
+        key_with_surrogates,
+        array,
+        object,
+    };
+
+    // array/object: length is the number of items/members that follow, strings and number literals: value is
+    // the offset into the arena and length the size, integer: value is the value
+    struct node {
+        kind type;
+        std::uint32_t length;
+        std::int64_t value;
+    };
+
+    // safe to call w/o the GIL
+    bool parse(const char* data, std::size_t size);
+    bool parse(const couchbase::core::utils::binary& value);
+
+    bool parsed() const
+    {
+        return parsed_;
+    }
+
+    bool valid() const
+    {
+        return valid_;
+    }
+
+    // memory held by the parsed document, e.g. for caches that keep tapes around
+    std::size_t memory_size() const
+    {
+        return sizeof(json_tape) + nodes_.capacity() * sizeof(node) + arena_.capacity() + error_.capacity();
+    }
+
+    // must be called w/ the GIL held, raises the parse error if the document was not valid
+    PyObject* materialize() const;
+
+  private:
+    PyObject* materialize_node(std::size_t& index, PyObject*& pyObj_key_memo) const;
+    PyObject* materialize_string(const node& n) const;
+
+    std::vector<node> nodes_{};
+    std::string arena_{};
+    std::string error_{};
+    bool parsed_{ false };
+    bool valid_{ false };
+    bool too_deep_{ false };
+};
+
+PyObject*
+pycbc_json_encode_method(PyObject* self, PyObject* args);
+
+PyObject*
+pycbc_json_decode_method(PyObject* self, PyObject* args);
@@ -17,9 +17,16 @@
 
 #include "kv_ops.hxx"
 #include "exceptions.hxx"
+#include "json_transcoder.hxx"
+#include "kv_result.hxx"
 #include "result.hxx"
 #include "tracing.hxx"
 #include "utils.hxx"
+#include <couchbase/error_codes.hxx>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
 
 template<typename T>
 result*
@@ -28,96 +35,100 @@ add_extras_to_result([[maybe_unused]] const T& resp, result* res)
     return res;
 }
 
-template<typename T>
-result*
-add_flags_and_value_to_result(const T& resp, result* res)
+bool
+is_json_format(std::uint32_t flags)
 {
-    PyObject* pyObj_tmp = PyLong_FromUnsignedLong(resp.flags);
-    if (-1 == PyDict_SetItemString(res->dict, RESULT_FLAGS, pyObj_tmp)) {
-        Py_XDECREF(pyObj_tmp);
-        return nullptr;
+    auto common_flags = flags & PYCBC_FMT_COMMON_MASK;
+    if (common_flags != 0) {
+        return common_flags == PYCBC_FMT_COMMON_JSON;
     }
-    Py_XDECREF(pyObj_tmp);
+    return (flags & PYCBC_FMT_LEGACY_MASK) == PYCBC_FMT_LEGACY_JSON;
+}
 
-    if (!res->ec) {
-        try {
-            pyObj_tmp = binary_to_PyObject(resp.value);
-        } catch (const std::exception& e) {
-            PyErr_SetString(PyExc_TypeError, e.what());
-            return nullptr;
-        }
-        if (-1 == PyDict_SetItemString(res->dict, RESULT_VALUE, pyObj_tmp)) {
-            Py_XDECREF(pyObj_tmp);
-            return nullptr;
-        }
-        Py_DECREF(pyObj_tmp);
-    }
-    return res;
+/**
+ * Runs on the IO thread (w/o the GIL) when the caller asked for native_json, so the dispatcher only has to
+ * materialize the already parsed document.  Only responses that carry a document are parsed.
+ */
+template<typename T>
+void
+prepare_json_tape([[maybe_unused]] const T& resp, [[maybe_unused]] json_tape& tape)
+{
 }
 
-template<>
-result*
-add_extras_to_result<couchbase::core::operations::exists_response>(const couchbase::core::operations::exists_response& resp, result* res)
+template<typename T>
+void
+parse_json_value(const T& resp, json_tape& tape)
 {
-    PyObject* pyObj_tmp = PyBool_FromLong(static_cast<long>(resp.exists()));
-    if (-1 == PyDict_SetItemString(res->dict, RESULT_EXISTS, pyObj_tmp)) {
-        Py_XDECREF(pyObj_tmp);
-        return nullptr;
+    if (!resp.ctx.ec() && is_json_format(resp.flags)) {
+        tape.parse(resp.value);
     }
-    Py_DECREF(pyObj_tmp);
-    return res;
 }
 
 template<>
-result*
-add_extras_to_result<couchbase::core::operations::get_projected_response>(const couchbase::core::operations::get_projected_response& resp,
-                                                                          result* res)
+void
+prepare_json_tape<couchbase::core::operations::get_response>(const couchbase::core::operations::get_response& resp, json_tape& tape)
 {
-    if (resp.expiry) {
-        PyObject* pyObj_tmp = PyLong_FromUnsignedLong(resp.expiry.value());
-        if (-1 == PyDict_SetItemString(res->dict, RESULT_EXPIRY, pyObj_tmp)) {
-            Py_XDECREF(pyObj_tmp);
-            return nullptr;
-        }
-        Py_DECREF(pyObj_tmp);
-    }
-
-    return add_flags_and_value_to_result(resp, res);
+    parse_json_value(resp, tape);
 }
 
 template<>
-result*
-add_extras_to_result<couchbase::core::operations::get_response>(const couchbase::core::operations::get_response& resp, result* res)
+void
+prepare_json_tape<couchbase::core::operations::get_projected_response>(const couchbase::core::operations::get_projected_response& resp,
+                                                                       json_tape& tape)
 {
-    return add_flags_and_value_to_result(resp, res);
+    parse_json_value(resp, tape);
 }
+
 template<>
-result*
-add_extras_to_result<couchbase::core::operations::get_and_lock_response>(const couchbase::core::operations::get_and_lock_response& resp,
-                                                                         result* res)
+void
+prepare_json_tape<couchbase::core::operations::get_and_lock_response>(const couchbase::core::operations::get_and_lock_response& resp,
+                                                                      json_tape& tape)
 {
-    return add_flags_and_value_to_result(resp, res);
+    parse_json_value(resp, tape);
 }
 
 template<>
-result*
-add_extras_to_result<couchbase::core::operations::get_and_touch_response>(const couchbase::core::operations::get_and_touch_response& resp,
-                                                                          result* res)
+void
+prepare_json_tape<couchbase::core::operations::get_and_touch_response>(const couchbase::core::operations::get_and_touch_response& resp,
+                                                                       json_tape& tape)
 {
-    return add_flags_and_value_to_result(resp, res);
+    parse_json_value(resp, tape);
 }
 
 template<>
-result*
-add_extras_to_result<couchbase::core::operations::get_any_replica_response>(
+void
+prepare_json_tape<couchbase::core::operations::get_any_replica_response>(
   const couchbase::core::operations::get_any_replica_response& resp,
-  result* res)
+  json_tape& tape)
 {
-    if (-1 == PyDict_SetItemString(res->dict, "is_replica", resp.replica ? Py_True : Py_False)) {
+    parse_json_value(resp, tape);
+}
+
+template<typename T>
+result*
+add_flags_and_value_to_result(const T& resp, result* res)
+{
+    PyObject* pyObj_tmp = PyLong_FromUnsignedLong(resp.flags);
+    if (-1 == PyDict_SetItemString(res->dict, RESULT_FLAGS, pyObj_tmp)) {
+        Py_XDECREF(pyObj_tmp);
         return nullptr;
     }
+    Py_XDECREF(pyObj_tmp);
 
-    return add_flags_and_value_to_result(resp, res);
+    if (!res->ec) {
+        try {
+            pyObj_tmp = binary_to_PyObject(resp.value);
+        } catch (const std::exception& e) {
+            PyErr_SetString(PyExc_TypeError, e.what());
+            return nullptr;
+        }
+        if (-1 == PyDict_SetItemString(res->dict, RESULT_VALUE, pyObj_tmp)) {
+            Py_XDECREF(pyObj_tmp);
+            return nullptr;
+        }
+        Py_DECREF(pyObj_tmp);
+    }
+    return res;
 }
 
 template<>
@@ -133,13 +144,11 @@ add_extras_to_result<couchbase::core::operations::get_all_replicas_response::ent
     return add_flags_and_value_to_result(resp, res);
 }
 
-template<typename T>
 result*
-create_base_result_from_get_operation_response(const char* key, const T& resp)
+create_base_result_from_get_operation_response(const char* key, const couchbase::core::operations::get_all_replicas_response::entry& resp)
 {
     PyObject* pyObj_result = create_result_obj();
     result* res = reinterpret_cast<result*>(pyObj_result);
-    res->ec = resp.ctx.ec();
 
     PyObject* pyObj_tmp = PyLong_FromUnsignedLongLong(resp.cas.value());
     if (-1 == PyDict_SetItemString(res->dict, RESULT_CAS, pyObj_tmp)) {
@@ -161,43 +170,202 @@ create_base_result_from_get_operation_response(const char* key, const T& resp)
     return res;
 }
 
-template<>
-result*
-create_base_result_from_get_operation_response<couchbase::core::operations::get_all_replicas_response::entry>(
-  const char* key,
-  const couchbase::core::operations::get_all_replicas_response::entry& resp)
+/**
+ * Used for the responses w/o a typed result (touch, unlock): the cas and key are only added to the result's
+ * dict once they are accessed.
+ */
+template<typename T>
+class lazy_get_result_fields : public lazy_result_fields
 {
-    PyObject* pyObj_result = create_result_obj();
-    result* res = reinterpret_cast<result*>(pyObj_result);
+  public:
+    lazy_get_result_fields(std::string key, T resp)
+      : key_{ std::move(key) }
+      , resp_{ std::move(resp) }
+    {
+    }
 
-    PyObject* pyObj_tmp = PyLong_FromUnsignedLongLong(resp.cas.value());
-    if (-1 == PyDict_SetItemString(res->dict, RESULT_CAS, pyObj_tmp)) {
-        Py_XDECREF(pyObj_result);
-        Py_XDECREF(pyObj_tmp);
-        return nullptr;
+    int materialize(const char* name, result* res) override
+    {
+        if (std::strcmp(name, RESULT_CAS) == 0) {
+            return add_cas(res);
+        }
+        if (std::strcmp(name, RESULT_KEY) == 0) {
+            return add_key(res);
+        }
+        return add_extras(res);
     }
-    Py_DECREF(pyObj_tmp);
 
-    if (nullptr != key) {
-        pyObj_tmp = PyUnicode_FromString(key);
+    int materialize_all(result* res) override
+    {
+        if (-1 == add_cas(res) || -1 == add_key(res)) {
+            return -1;
+        }
+        return add_extras(res);
+    }
+
+  private:
+    int add_cas(result* res)
+    {
+        if (cas_added_) {
+            return 0;
+        }
+        cas_added_ = true;
+        PyObject* pyObj_tmp = PyLong_FromUnsignedLongLong(resp_.cas.value());
+        if (-1 == PyDict_SetItemString(res->dict, RESULT_CAS, pyObj_tmp)) {
+            Py_XDECREF(pyObj_tmp);
+            return -1;
+        }
+        Py_DECREF(pyObj_tmp);
+        return 0;
+    }
+
+    int add_key(result* res)
+    {
+        if (key_added_) {
+            return 0;
+        }
+        key_added_ = true;
+        PyObject* pyObj_tmp = PyUnicode_FromStringAndSize(key_.data(), static_cast<Py_ssize_t>(key_.size()));
         if (-1 == PyDict_SetItemString(res->dict, RESULT_KEY, pyObj_tmp)) {
-            Py_XDECREF(pyObj_result);
             Py_XDECREF(pyObj_tmp);
-            return nullptr;
+            return -1;
         }
         Py_DECREF(pyObj_tmp);
+        return 0;
     }
-    return res;
+
+    int add_extras(result* res)
+    {
+        if (extras_added_) {
+            return 0;
+        }
+        extras_added_ = true;
+        return add_extras_to_result(resp_, res) == nullptr ? -1 : 0;
+    }
+
+    std::string key_;
+    T resp_;
+    bool cas_added_{ false };
+    bool key_added_{ false };
+    bool extras_added_{ false };
+};
+
+template<typename T>
+PyObject*
+create_get_operation_result(const char* key, T resp, [[maybe_unused]] std::shared_ptr<json_tape> tape)
+{
+    PyObject* pyObj_result = create_result_obj();
+    if (pyObj_result == nullptr) {
+        return nullptr;
+    }
+    result* res = reinterpret_cast<result*>(pyObj_result);
+    res->ec = resp.ctx.ec();
+    res->lazy = new lazy_get_result_fields<T>(key, std::move(resp));
+    return pyObj_result;
+}
+
+template<typename T>
+PyObject*
+create_get_result_from_response(const char* key,
+                                T& resp,
+                                std::shared_ptr<json_tape> tape,
+                                std::optional<std::uint32_t> expiry = {},
+                                std::optional<bool> is_replica = {})
+{
+    get_result_fields fields{};
+    fields.ec = resp.ctx.ec();
+    fields.cas = resp.cas.value();
+    fields.flags = resp.flags;
+    fields.key = key;
+    fields.value = std::move(resp.value);
+    fields.tape = std::move(tape);
+    fields.expiry = expiry;
+    fields.is_replica = is_replica;
+    return create_get_result_obj(std::move(fields));
+}
+
+template<>
+PyObject*
+create_get_operation_result<couchbase::core::operations::get_response>(const char* key,
+                                                                       couchbase::core::operations::get_response resp,
+                                                                       std::shared_ptr<json_tape> tape)
+{
+    return create_get_result_from_response(key, resp, std::move(tape));
+}
+
+template<>
+PyObject*
+create_get_operation_result<couchbase::core::operations::get_projected_response>(const char* key,
+                                                                                 couchbase::core::operations::get_projected_response resp,
+                                                                                 std::shared_ptr<json_tape> tape)
+{
+    return create_get_result_from_response(key, resp, std::move(tape), resp.expiry);
+}
+
+template<>
+PyObject*
+create_get_operation_result<couchbase::core::operations::get_and_lock_response>(const char* key,
+                                                                                couchbase::core::operations::get_and_lock_response resp,
+                                                                                std::shared_ptr<json_tape> tape)
+{
+    return create_get_result_from_response(key, resp, std::move(tape));
+}
+
+template<>
+PyObject*
+create_get_operation_result<couchbase::core::operations::get_and_touch_response>(const char* key,
+                                                                                 couchbase::core::operations::get_and_touch_response resp,
+                                                                                 std::shared_ptr<json_tape> tape)
+{
+    return create_get_result_from_response(key, resp, std::move(tape));
+}
+
+template<>
+PyObject*
+create_get_operation_result<couchbase::core::operations::get_any_replica_response>(
+  const char* key,
+  couchbase::core::operations::get_any_replica_response resp,
+  std::shared_ptr<json_tape> tape)
+{
+    return create_get_result_from_response(key, resp, std::move(tape), std::nullopt, resp.replica);
+}
+
+template<>
+PyObject*
+create_get_operation_result<couchbase::core::operations::exists_response>(const char* key,
+                                                                          couchbase::core::operations::exists_response resp,
+                                                                          [[maybe_unused]] std::shared_ptr<json_tape> tape)
+{
+    exists_result_fields fields{};
+    fields.ec = resp.ctx.ec();
+    fields.cas = resp.cas.value();
+    fields.key = key;
+    fields.exists = resp.exists();
+    return create_exists_result_obj(std::move(fields));
+}
+
+// whether ec is one of the errors the read was asked to report w/ a miss_result
+bool
+is_read_miss(std::error_code ec, std::uint8_t miss_errors)
+{
+    if (miss_errors == 0) {
+        return false;
+    }
+    return ((miss_errors & read_miss_not_found) != 0 && ec == couchbase::errc::key_value::document_not_found) ||
+           ((miss_errors & read_miss_cas_mismatch) != 0 && ec == couchbase::errc::common::cas_mismatch) ||
+           ((miss_errors & read_miss_locked) != 0 && ec == couchbase::errc::key_value::document_locked);
 }
 
 template<typename T>
 void
 create_result_from_get_operation_response(const char* key,
-                                          const T& resp,
+                                          T resp,
                                           PyObject* pyObj_callback,
                                           PyObject* pyObj_errback,
                                           std::shared_ptr<std::promise<PyObject*>> barrier,
-                                          result* multi_result = nullptr)
+                                          result* multi_result = nullptr,
+                                          std::shared_ptr<json_tape> tape = nullptr,
+                                          std::uint8_t miss_errors = 0)
 {
     PyGILState_STATE state = PyGILState_Ensure();
     PyObject* pyObj_args = NULL;
@@ -207,19 +375,11 @@ create_result_from_get_operation_response(const char* key,
     PyObject* pyObj_callback_res = nullptr;
     auto set_exception = false;
 
-    if (resp.ctx.ec()) {
+    if (resp.ctx.ec() && !is_read_miss(resp.ctx.ec(), miss_errors)) {
         pyObj_exc = build_exception_from_context(resp.ctx, __FILE__, __LINE__, "KV read operation error.");
         if (pyObj_errback == nullptr) {
             if (multi_result != nullptr) {
-                Py_INCREF(Py_False);
-                barrier->set_value(Py_False);
-                if (-1 == PyDict_SetItemString(multi_result->dict, key, pyObj_exc)) {
-                    // TODO:  not much we can do here...maybe?
-                    PyErr_Print();
-                    PyErr_Clear();
-                }
-                // won't fall into logic path where pyObj_exc is decremented later
-                Py_DECREF(pyObj_exc);
+                add_multi_op_result(multi_result, key, pyObj_exc, false, barrier);
             } else {
                 barrier->set_value(pyObj_exc);
             }
@@ -231,31 +391,24 @@ create_result_from_get_operation_response(const char* key,
         // lets clear any errors
         PyErr_Clear();
     } else {
-        auto res = create_base_result_from_get_operation_response(key, resp);
-        if (res != nullptr) {
-            res = add_extras_to_result(resp, res);
-        }
+        // a miss is handed back like a successful result, just w/o any fields
+        // the fields are only converted to Python objects once they are accessed
+        PyObject* pyObj_res = resp.ctx.ec() ? create_miss_result_obj(resp.ctx.ec())
+                                            : create_get_operation_result(key, std::move(resp), std::move(tape));
 
-        if (res == nullptr || PyErr_Occurred() != nullptr) {
+        if (pyObj_res == nullptr || PyErr_Occurred() != nullptr) {
             set_exception = true;
         } else {
             if (pyObj_callback == nullptr) {
                 if (multi_result != nullptr) {
-                    Py_INCREF(Py_True);
-                    barrier->set_value(Py_True);
-                    if (-1 == PyDict_SetItemString(multi_result->dict, key, reinterpret_cast<PyObject*>(res))) {
-                        // TODO:  not much we can do here...maybe?
-                        PyErr_Print();
-                        PyErr_Clear();
-                    }
-                    Py_DECREF(reinterpret_cast<PyObject*>(res));
+                    add_multi_op_result(multi_result, key, pyObj_res, true, barrier);
                 } else {
-                    barrier->set_value(reinterpret_cast<PyObject*>(res));
+                    barrier->set_value(pyObj_res);
                 }
             } else {
                 pyObj_func = pyObj_callback;
                 pyObj_args = PyTuple_New(1);
-                PyTuple_SET_ITEM(pyObj_args, 0, reinterpret_cast<PyObject*>(res));
+                PyTuple_SET_ITEM(pyObj_args, 0, pyObj_res);
             }
         }
     }
@@ -264,15 +417,7 @@ create_result_from_get_operation_response(const char* key,
         pyObj_exc = pycbc_build_exception(PycbcError::UnableToBuildResult, __FILE__, __LINE__, "KV read operation error.");
         if (pyObj_errback == nullptr) {
             if (multi_result != nullptr) {
-                Py_INCREF(Py_False);
-                barrier->set_value(Py_False);
-                if (-1 == PyDict_SetItemString(multi_result->dict, key, pyObj_exc)) {
-                    // TODO:  not much we can do here...maybe?
-                    PyErr_Print();
-                    PyErr_Clear();
-                }
-                // won't fall into logic path where pyObj_exc is decremented later
-                Py_DECREF(pyObj_exc);
+                add_multi_op_result(multi_result, key, pyObj_exc, false, barrier);
             } else {
                 barrier->set_value(pyObj_exc);
             }
@@ -303,11 +448,13 @@ template<>
 void
 create_result_from_get_operation_response<couchbase::core::operations::get_all_replicas_response>(
   const char* key,
-  const couchbase::core::operations::get_all_replicas_response& resp,
+  couchbase::core::operations::get_all_replicas_response resp,
   PyObject* pyObj_callback,
   PyObject* pyObj_errback,
   std::shared_ptr<std::promise<PyObject*>> barrier,
-  result* multi_result)
+  result* multi_result,
+  [[maybe_unused]] std::shared_ptr<json_tape> tape,
+  [[maybe_unused]] std::uint8_t miss_errors)
 {
     PyGILState_STATE state = PyGILState_Ensure();
     PyObject* pyObj_args = NULL;
@@ -322,15 +469,7 @@ create_result_from_get_operation_response<couchbase::core::operations::get_all_r
         pyObj_exc = build_exception_from_context(resp.ctx, __FILE__, __LINE__, "KV read operation error.");
         if (pyObj_errback == nullptr) {
             if (multi_result != nullptr) {
-                Py_INCREF(Py_False);
-                barrier->set_value(Py_False);
-                if (-1 == PyDict_SetItemString(multi_result->dict, key, pyObj_exc)) {
-                    // TODO:  not much we can do here...maybe?
-                    PyErr_Print();
-                    PyErr_Clear();
-                }
-                // won't fall into logic path where pyObj_exc is decremented later
-                Py_DECREF(pyObj_exc);
+                add_multi_op_result(multi_result, key, pyObj_exc, false, barrier);
             } else {
                 barrier->set_value(pyObj_exc);
             }
@@ -342,7 +481,7 @@ create_result_from_get_operation_response<couchbase::core::operations::get_all_r
         // lets clear any errors
         PyErr_Clear();
     } else {
-        auto streamed_res = create_streamed_result_obj(couchbase::core::timeout_defaults::key_value_durable_timeout);
+        streamed_res = create_streamed_result_obj(couchbase::core::timeout_defaults::key_value_durable_timeout);
         for (auto const& entry : resp.entries) {
             auto res = create_base_result_from_get_operation_response(key, entry);
             if (res == nullptr) {
@@ -350,8 +489,9 @@ create_result_from_get_operation_response<couchbase::core::operations::get_all_r
                 break;
             }
             res = add_extras_to_result(entry, res);
-            streamed_res->rows->put(reinterpret_cast<PyObject*>(res));
+            streamed_res->rows->stage(reinterpret_cast<PyObject*>(res));
         }
+        streamed_res->rows->publish();
 
         if (PyErr_Occurred() != nullptr) {
             set_exception = true;
@@ -360,14 +500,7 @@ create_result_from_get_operation_response<couchbase::core::operations::get_all_r
             streamed_res->rows->put(Py_None);
             if (pyObj_callback == nullptr) {
                 if (multi_result != nullptr) {
-                    Py_INCREF(Py_True);
-                    barrier->set_value(Py_True);
-                    if (-1 == PyDict_SetItemString(multi_result->dict, key, reinterpret_cast<PyObject*>(streamed_res))) {
-                        // TODO:  not much we can do here...maybe?
-                        PyErr_Print();
-                        PyErr_Clear();
-                    }
-                    Py_DECREF(reinterpret_cast<PyObject*>(streamed_res));
+                    add_multi_op_result(multi_result, key, reinterpret_cast<PyObject*>(streamed_res), true, barrier);
                 } else {
                     barrier->set_value(reinterpret_cast<PyObject*>(streamed_res));
                 }
@@ -384,15 +517,7 @@ create_result_from_get_operation_response<couchbase::core::operations::get_all_r
         streamed_res->rows->put(pyObj_exc);
         if (pyObj_errback == nullptr) {
             if (multi_result != nullptr) {
-                Py_INCREF(Py_False);
-                barrier->set_value(Py_False);
-                if (-1 == PyDict_SetItemString(multi_result->dict, key, reinterpret_cast<PyObject*>(streamed_res))) {
-                    // TODO:  not much we can do here...maybe?
-                    PyErr_Print();
-                    PyErr_Clear();
-                }
-                // won't fall into logic path where pyObj_exc is decremented later
-                Py_DECREF(pyObj_exc);
+                add_multi_op_result(multi_result, key, reinterpret_cast<PyObject*>(streamed_res), false, barrier);
             } else {
                 barrier->set_value(reinterpret_cast<PyObject*>(streamed_res));
             }
@@ -417,6 +542,37 @@ create_result_from_get_operation_response<couchbase::core::operations::get_all_r
     PyGILState_Release(state);
 }
 
+/**
+ * Reads that also change the document's CAS, expiry or lock.  They are submitted like mutations, so a GET answered
+ * from the read cache afterwards does not return the old CAS (or hide the lock).
+ */
+template<typename Request>
+constexpr bool changes_document_v = std::is_same_v<Request, couchbase::core::operations::get_and_touch_request> ||
+                                    std::is_same_v<Request, couchbase::core::operations::get_and_lock_request> ||
+                                    std::is_same_v<Request, couchbase::core::operations::touch_request> ||
+                                    std::is_same_v<Request, couchbase::core::operations::unlock_request>;
+
+template<typename Request, typename Handler, typename Prepare>
+void
+submit_read(connection& conn, Request& req, Handler&& handler, Prepare&& prepare, kv_batch* batch)
+{
+    if constexpr (changes_document_v<Request>) {
+        if (batch != nullptr) {
+            batch->add_mutation(conn, req, std::forward<Handler>(handler), std::forward<Prepare>(prepare));
+            return;
+        }
+        Py_BEGIN_ALLOW_THREADS conn.execute_mutation(req, std::forward<Handler>(handler), std::forward<Prepare>(prepare));
+        Py_END_ALLOW_THREADS
+    } else {
+        if (batch != nullptr) {
+            batch->add(conn, req, std::forward<Handler>(handler), std::forward<Prepare>(prepare));
+            return;
+        }
+        Py_BEGIN_ALLOW_THREADS conn.execute(req, std::forward<Handler>(handler), std::forward<Prepare>(prepare));
+        Py_END_ALLOW_THREADS
+    }
+}
+
 template<typename Request>
 void
 do_get(connection& conn,
@@ -424,13 +580,357 @@ do_get(connection& conn,
        PyObject* pyObj_callback,
        PyObject* pyObj_errback,
        std::shared_ptr<std::promise<PyObject*>> barrier,
-       result* multi_result = nullptr)
+       result* multi_result = nullptr,
+       kv_batch* batch = nullptr,
+       bool native_json = false,
+       std::uint8_t miss_errors = 0)
 {
     using response_type = typename Request::response_type;
-    Py_BEGIN_ALLOW_THREADS conn.cluster_->execute(
-      req, [key = req.id.key(), pyObj_callback, pyObj_errback, barrier, multi_result](response_type resp) {
-          create_result_from_get_operation_response(key.c_str(), resp, pyObj_callback, pyObj_errback, barrier, multi_result);
-      });
+    if (native_json) {
+        // the document is parsed on the IO thread, the handler only builds the Python objects
+        auto tape = std::make_shared<json_tape>();
+        auto handler = [key = req.id.key(), pyObj_callback, pyObj_errback, barrier, multi_result, tape, miss_errors](response_type resp) {
+            create_result_from_get_operation_response(
+              key.c_str(), std::move(resp), pyObj_callback, pyObj_errback, barrier, multi_result, tape, miss_errors);
+        };
+        auto prepare = [tape](const response_type& resp) { prepare_json_tape(resp, *tape); };
+        submit_read(conn, req, std::move(handler), std::move(prepare), batch);
+        return;
+    }
+    auto handler = [key = req.id.key(), pyObj_callback, pyObj_errback, barrier, multi_result, miss_errors](response_type resp) {
+        create_result_from_get_operation_response(
+          key.c_str(), std::move(resp), pyObj_callback, pyObj_errback, barrier, multi_result, nullptr, miss_errors);
+    };
+    submit_read(conn, req, std::move(handler), [](const response_type&) {}, batch);
+}
+
+/**
+ * The active GET and the replica read hedging it.  The response handlers run on the dispatcher one after the
+ * other, the first successful one (or the active's error) completes the caller and the other is dropped.
+ */
+struct hedged_read {
+    explicit hedged_read(asio::io_context& io)
+      : timer{ io }
+    {
+    }
+
+    asio::steady_timer timer;
+    std::atomic<bool> done{ false };
+};
+
+void
+do_hedged_get(connection& conn,
+              couchbase::core::operations::get_request& req,
+              PyObject* pyObj_callback,
+              PyObject* pyObj_errback,
+              std::shared_ptr<std::promise<PyObject*>> barrier,
+              result* multi_result = nullptr,
+              kv_batch* batch = nullptr,
+              bool native_json = false,
+              std::uint8_t miss_errors = 0)
+{
+    using response_type = couchbase::core::operations::get_response;
+    using replica_response_type = couchbase::core::operations::get_any_replica_response;
+    auto hedge = std::make_shared<hedged_read>(conn.io_);
+    auto tape = native_json ? std::make_shared<json_tape>() : nullptr;
+    auto replica_tape = native_json ? std::make_shared<json_tape>() : nullptr;
+
+    auto handler = [key = req.id.key(), hedge, pyObj_callback, pyObj_errback, barrier, multi_result, tape, miss_errors](
+                     response_type resp) {
+        if (hedge->done.exchange(true)) {
+            return;
+        }
+        create_result_from_get_operation_response(
+          key.c_str(), std::move(resp), pyObj_callback, pyObj_errback, barrier, multi_result, tape, miss_errors);
+    };
+    auto prepare = [tape](const response_type& resp) {
+        if (tape) {
+            prepare_json_tape(resp, *tape);
+        }
+    };
+    // a failed replica read is not reported, the active's response (or timeout) still completes the caller
+    auto replica_handler =
+      [&conn, key = req.id.key(), hedge, pyObj_callback, pyObj_errback, barrier, multi_result, replica_tape, miss_errors](
+        replica_response_type resp) {
+          if (resp.ctx.ec() || hedge->done.exchange(true)) {
+              return;
+          }
+          conn.hedged_reads_won_++;
+          create_result_from_get_operation_response(
+            key.c_str(), std::move(resp), pyObj_callback, pyObj_errback, barrier, multi_result, replica_tape, miss_errors);
+      };
+    auto replica_prepare = [replica_tape](const replica_response_type& resp) {
+        if (replica_tape) {
+            prepare_json_tape(resp, *replica_tape);
+        }
+    };
+
+    // the timer is only armed once the active read has been submitted, w/ a batch that is after the whole batch
+    // was built.  It is never cancelled (the handlers run on other threads), once it fires after the active
+    // answered it only drops its references
+    auto submit = [&conn,
+                   req,
+                   hedge,
+                   handler = std::move(handler),
+                   prepare = std::move(prepare),
+                   replica_handler = std::move(replica_handler),
+                   replica_prepare = std::move(replica_prepare)]() mutable {
+        couchbase::core::operations::get_any_replica_request replica_req{ req.id, req.timeout };
+        conn.execute(std::move(req), std::move(handler), std::move(prepare));
+        hedge->timer.expires_after(conn.hedge_reads_after_);
+        hedge->timer.async_wait([&conn,
+                                 hedge,
+                                 replica_req = std::move(replica_req),
+                                 replica_handler = std::move(replica_handler),
+                                 replica_prepare = std::move(replica_prepare)](std::error_code ec) mutable {
+            if (ec || hedge->done.load()) {
+                return;
+            }
+            conn.hedged_reads_++;
+            conn.execute(std::move(replica_req), std::move(replica_handler), std::move(replica_prepare));
+        });
+    };
+
+    if (batch != nullptr) {
+        batch->add_submit(conn.shard_for(req.id), std::move(submit));
+        return;
+    }
+    Py_BEGIN_ALLOW_THREADS submit();
+    Py_END_ALLOW_THREADS
+}
+
+/**
+ * Single-flight read: a caller asking for a document/operation that is already in flight attaches to that
+ * request instead of sending its own, the response then completes every waiter.  Attaching callers share the
+ * timeout (and span) of the request they join.
+ */
+template<typename Request>
+void
+do_coalesced_read(connection& conn,
+                  Request& req,
+                  Operations::OperationType op_type,
+                  PyObject* pyObj_callback,
+                  PyObject* pyObj_errback,
+                  std::shared_ptr<std::promise<PyObject*>> barrier,
+                  result* multi_result = nullptr,
+                  kv_batch* batch = nullptr,
+                  bool native_json = false,
+                  std::uint8_t miss_errors = 0)
+{
+    using response_type = typename Request::response_type;
+    coalesced_read::waiter waiter{ pyObj_callback, pyObj_errback, barrier, multi_result, miss_errors };
+    auto name = connection::inflight_read_name(req.id);
+    auto variant = std::to_string(static_cast<int>(op_type)) + (native_json ? "/json" : "");
+    auto inflight = std::make_shared<coalesced_read>();
+    {
+        std::lock_guard<std::mutex> lock(conn.inflight_reads_mutex_);
+        auto& reads = conn.inflight_reads_[name];
+        if (auto it = reads.find(variant); it != reads.end()) {
+            it->second->waiters.emplace_back(std::move(waiter));
+            conn.coalesced_reads_++;
+            return;
+        }
+        inflight->waiters.emplace_back(std::move(waiter));
+        reads.emplace(variant, inflight);
+    }
+
+    auto tape = native_json ? std::make_shared<json_tape>() : nullptr;
+    auto handler = [&conn, name, variant, key = req.id.key(), inflight, tape](response_type resp) {
+        PyGILState_STATE state = PyGILState_Ensure();
+        std::vector<coalesced_read::waiter> waiters;
+        {
+            // reads issued from here on (e.g. by a callback) have to go to the server again.  A mutation may
+            // have detached this read already and a newer one taken its place, that one is left alone
+            std::lock_guard<std::mutex> lock(conn.inflight_reads_mutex_);
+            if (auto doc = conn.inflight_reads_.find(name); doc != conn.inflight_reads_.end()) {
+                if (auto it = doc->second.find(variant); it != doc->second.end() && it->second == inflight) {
+                    doc->second.erase(it);
+                }
+                if (doc->second.empty()) {
+                    conn.inflight_reads_.erase(doc);
+                }
+            }
+            waiters = std::move(inflight->waiters);
+        }
+        for (std::size_t i = 0; i < waiters.size(); i++) {
+            const auto& w = waiters[i];
+            if (i + 1 < waiters.size()) {
+                create_result_from_get_operation_response(
+                  key.c_str(), resp, w.pyObj_callback, w.pyObj_errback, w.barrier, w.multi_result, tape, w.miss_errors);
+            } else {
+                create_result_from_get_operation_response(
+                  key.c_str(), std::move(resp), w.pyObj_callback, w.pyObj_errback, w.barrier, w.multi_result, tape, w.miss_errors);
+            }
+        }
+        PyGILState_Release(state);
+    };
+    auto prepare = [tape](const response_type& resp) {
+        if (tape) {
+            prepare_json_tape(resp, *tape);
+        }
+    };
+    if (batch != nullptr) {
+        batch->add(conn, req, std::move(handler), std::move(prepare));
+        return;
+    }
+    Py_BEGIN_ALLOW_THREADS conn.execute(req, std::move(handler), std::move(prepare));
+    Py_END_ALLOW_THREADS
+}
+
+/**
+ * Answers a GET from the collection's read cache, w/o a round trip.  Runs w/ the GIL held, the result shares
+ * the cached document and (native_json) the tape it was parsed into when it was cached, so only the Python
+ * objects are created here.
+ */
+void
+create_result_from_read_cache(const std::string& key,
+                              read_cache::entry entry,
+                              bool native_json,
+                              PyObject* pyObj_callback,
+                              PyObject* pyObj_errback,
+                              std::shared_ptr<std::promise<PyObject*>> barrier,
+                              result* multi_result = nullptr)
+{
+    get_result_fields fields{};
+    fields.cas = entry.cas;
+    fields.flags = entry.flags;
+    fields.key = key;
+    fields.shared_value = std::move(entry.value);
+    if (native_json) {
+        fields.tape = std::move(entry.tape);
+    }
+    PyObject* pyObj_res = create_get_result_obj(std::move(fields));
+    auto success = pyObj_res != nullptr && PyErr_Occurred() == nullptr;
+    if (!success) {
+        Py_XDECREF(pyObj_res);
+        PyErr_Clear();
+        pyObj_res = pycbc_build_exception(PycbcError::UnableToBuildResult, __FILE__, __LINE__, "KV read operation error.");
+    }
+
+    PyObject* pyObj_func = success ? pyObj_callback : pyObj_errback;
+    if (pyObj_func == nullptr) {
+        if (multi_result != nullptr) {
+            add_multi_op_result(multi_result, key.c_str(), pyObj_res, success, barrier);
+        } else {
+            barrier->set_value(pyObj_res);
+        }
+        return;
+    }
+    PyObject* pyObj_args = PyTuple_New(1);
+    PyTuple_SET_ITEM(pyObj_args, 0, pyObj_res);
+    PyObject* pyObj_callback_res = PyObject_Call(pyObj_func, pyObj_args, nullptr);
+    if (pyObj_callback_res) {
+        Py_DECREF(pyObj_callback_res);
+    } else {
+        PyErr_Print();
+    }
+    Py_DECREF(pyObj_args);
+    Py_XDECREF(pyObj_callback);
+    Py_XDECREF(pyObj_errback);
+}
+
+/**
+ * GET for a collection w/ a read cache, a successful response fills the cache on the IO thread unless the key
+ * was mutated since the lookup that returned epoch (see read_cache::put()).  JSON documents are parsed there
+ * as well, once, for all the hits that follow.
+ */
+void
+do_cached_get(connection& conn,
+              couchbase::core::operations::get_request& req,
+              std::shared_ptr<read_cache> cache,
+              std::uint64_t epoch,
+              PyObject* pyObj_callback,
+              PyObject* pyObj_errback,
+              std::shared_ptr<std::promise<PyObject*>> barrier,
+              result* multi_result = nullptr,
+              kv_batch* batch = nullptr,
+              bool native_json = false,
+              std::uint8_t miss_errors = 0)
+{
+    using response_type = couchbase::core::operations::get_response;
+    auto tape = native_json ? std::make_shared<json_tape>() : nullptr;
+    auto handler = [key = req.id.key(), pyObj_callback, pyObj_errback, barrier, multi_result, tape, miss_errors](response_type resp) {
+        create_result_from_get_operation_response(
+          key.c_str(), std::move(resp), pyObj_callback, pyObj_errback, barrier, multi_result, tape, miss_errors);
+    };
+    auto prepare = [key = req.id.key(), cache, epoch, tape](const response_type& resp) {
+        if (tape) {
+            prepare_json_tape(resp, *tape);
+        }
+        if (resp.ctx.ec() || resp.value.size() > cache->max_bytes()) {
+            return;
+        }
+        // the tape is only read from now on, the caller's result and the cache share it
+        std::shared_ptr<const json_tape> cached_tape = tape;
+        if (!cached_tape && is_json_format(resp.flags)) {
+            auto parsed = std::make_shared<json_tape>();
+            parsed->parse(resp.value);
+            cached_tape = std::move(parsed);
+        }
+        if (cached_tape && !cached_tape->valid()) {
+            // hits hand the raw document to the transcoder, as a miss would
+            cached_tape.reset();
+        }
+        cache->put(key,
+                   std::make_shared<const couchbase::core::utils::binary>(resp.value),
+                   std::move(cached_tape),
+                   resp.flags,
+                   resp.cas.value(),
+                   epoch);
+    };
+    if (batch != nullptr) {
+        batch->add(conn, req, std::move(handler), std::move(prepare));
+        return;
+    }
+    Py_BEGIN_ALLOW_THREADS conn.execute(req, std::move(handler), std::move(prepare));
+    Py_END_ALLOW_THREADS
+}
+
+/**
+ * The cached entry outlived its TTL.  Rather than fetching the document again, ask the server whether its CAS
+ * is still current (EXISTS, no body is sent back) and only fall back to a full GET if it changed.
+ */
+void
+revalidate_cached_get(connection& conn,
+                      couchbase::core::operations::get_request& req,
+                      std::shared_ptr<read_cache> cache,
+                      read_cache::entry entry,
+                      std::uint64_t epoch,
+                      PyObject* pyObj_callback,
+                      PyObject* pyObj_errback,
+                      std::shared_ptr<std::promise<PyObject*>> barrier,
+                      result* multi_result = nullptr,
+                      kv_batch* batch = nullptr,
+                      bool native_json = false,
+                      std::uint8_t miss_errors = 0)
+{
+    couchbase::core::operations::exists_request probe{ req.id };
+    probe.timeout = req.timeout;
+    auto handler = [&conn,
+                    req,
+                    cache,
+                    entry = std::move(entry),
+                    epoch,
+                    pyObj_callback,
+                    pyObj_errback,
+                    barrier,
+                    multi_result,
+                    native_json,
+                    miss_errors](couchbase::core::operations::exists_response resp) mutable {
+        PyGILState_STATE state = PyGILState_Ensure();
+        if (!resp.ctx.ec() && resp.exists() && cache->refresh(req.id.key(), resp.cas.value())) {
+            create_result_from_read_cache(
+              req.id.key(), std::move(entry), native_json, pyObj_callback, pyObj_errback, barrier, multi_result);
+        } else {
+            do_cached_get(conn, req, cache, epoch, pyObj_callback, pyObj_errback, barrier, multi_result, nullptr, native_json, miss_errors);
+        }
+        PyGILState_Release(state);
+    };
+    if (batch != nullptr) {
+        batch->add(conn, probe, std::move(handler));
+        return;
+    }
+    Py_BEGIN_ALLOW_THREADS conn.execute(probe, std::move(handler));
     Py_END_ALLOW_THREADS
 }
 
@@ -439,7 +939,8 @@ prepare_and_execute_read_op(struct read_options* options,
                             PyObject* pyObj_callback,
                             PyObject* pyObj_errback,
                             std::shared_ptr<std::promise<PyObject*>> barrier,
-                            result* multi_result = nullptr)
+                            result* multi_result = nullptr,
+                            kv_batch* batch = nullptr)
 {
     switch (options->op_type) {
         case Operations::GET: {
@@ -448,7 +949,78 @@ prepare_and_execute_read_op(struct read_options* options,
             if (nullptr != options->span) {
                 req.parent_span = std::make_shared<pycbc::request_span>(options->span);
             }
-            do_get<couchbase::core::operations::get_request>(*(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result);
+            if (auto cache = options->conn->read_cache_for(options->id); cache) {
+                read_cache::entry entry;
+                std::uint64_t epoch = 0;
+                switch (cache->lookup(req.id.key(), entry, epoch)) {
+                    case read_cache::lookup_state::hit:
+                        create_result_from_read_cache(
+                          req.id.key(), std::move(entry), options->native_json, pyObj_callback, pyObj_errback, barrier, multi_result);
+                        break;
+                    case read_cache::lookup_state::stale:
+                        revalidate_cached_get(*(options->conn),
+                                              req,
+                                              std::move(cache),
+                                              std::move(entry),
+                                              epoch,
+                                              pyObj_callback,
+                                              pyObj_errback,
+                                              barrier,
+                                              multi_result,
+                                              batch,
+                                              options->native_json,
+                                              options->miss_errors);
+                        break;
+                    case read_cache::lookup_state::miss:
+                        do_cached_get(*(options->conn),
+                                      req,
+                                      std::move(cache),
+                                      epoch,
+                                      pyObj_callback,
+                                      pyObj_errback,
+                                      barrier,
+                                      multi_result,
+                                      batch,
+                                      options->native_json,
+                                      options->miss_errors);
+                        break;
+                }
+                break;
+            }
+            if (options->conn->coalesce_reads_) {
+                do_coalesced_read(*(options->conn),
+                                  req,
+                                  options->op_type,
+                                  pyObj_callback,
+                                  pyObj_errback,
+                                  barrier,
+                                  multi_result,
+                                  batch,
+                                  options->native_json,
+                                  options->miss_errors);
+                break;
+            }
+            if (options->conn->hedge_reads_after_.count() > 0) {
+                do_hedged_get(*(options->conn),
+                              req,
+                              pyObj_callback,
+                              pyObj_errback,
+                              barrier,
+                              multi_result,
+                              batch,
+                              options->native_json,
+                              options->miss_errors);
+                break;
+            }
+            do_get<couchbase::core::operations::get_request>(*(options->conn),
+                                                             req,
+                                                             pyObj_callback,
+                                                             pyObj_errback,
+                                                             barrier,
+                                                             multi_result,
+                                                             batch,
+                                                             options->native_json,
+                                                             options->miss_errors);
             break;
         }
         case Operations::GET_PROJECTED: {
@@ -474,14 +1046,7 @@ prepare_and_execute_read_op(struct read_options* options,
                     if (multi_result != nullptr) {
                         PyObject* pyObj_exc =
                           pycbc_build_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Project must be a list of strings.");
-                        if (-1 == PyDict_SetItemString(multi_result->dict, options->id.key().c_str(), pyObj_exc)) {
-                            // TODO:  not much we can do here...maybe?
-                            PyErr_Print();
-                            PyErr_Clear();
-                        }
-                        Py_DECREF(pyObj_exc);
-                        Py_INCREF(Py_False);
-                        barrier->set_value(Py_False);
+                        add_multi_op_result(multi_result, options->id.key().c_str(), pyObj_exc, false, barrier);
                     } else {
                         if (barrier) {
                             barrier->set_value(nullptr);
@@ -501,20 +1066,27 @@ prepare_and_execute_read_op(struct read_options* options,
             if (nullptr != options->span) {
                 req.parent_span = std::make_shared<pycbc::request_span>(options->span);
             }
-            do_get<couchbase::core::operations::get_projected_request>(
-              *(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result);
+            do_get<couchbase::core::operations::get_projected_request>(*(options->conn),
+                                                                       req,
+                                                                       pyObj_callback,
+                                                                       pyObj_errback,
+                                                                       barrier,
+                                                                       multi_result,
+                                                                       batch,
+                                                                       options->native_json,
+                                                                       options->miss_errors);
             break;
         }
         case Operations::GET_ANY_REPLICA: {
             couchbase::core::operations::get_any_replica_request req{ options->id, options->timeout_ms };
             do_get<couchbase::core::operations::get_any_replica_request>(
-              *(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result);
+              *(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result, batch, options->native_json);
             break;
         }
         case Operations::GET_ALL_REPLICAS: {
             couchbase::core::operations::get_all_replicas_request req{ options->id, options->timeout_ms };
             do_get<couchbase::core::operations::get_all_replicas_request>(
-              *(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result);
+              *(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result, batch);
             break;
         }
         case Operations::GET_AND_TOUCH: {
@@ -525,7 +1097,7 @@ prepare_and_execute_read_op(struct read_options* options,
                 req.parent_span = std::make_shared<pycbc::request_span>(options->span);
             }
             do_get<couchbase::core::operations::get_and_touch_request>(
-              *(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result);
+              *(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result, batch, options->native_json);
             break;
         }
         case Operations::GET_AND_LOCK: {
@@ -536,7 +1108,7 @@ prepare_and_execute_read_op(struct read_options* options,
                 req.parent_span = std::make_shared<pycbc::request_span>(options->span);
             }
             do_get<couchbase::core::operations::get_and_lock_request>(
-              *(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result);
+              *(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result, batch, options->native_json);
             break;
         }
         case Operations::EXISTS: {
@@ -545,8 +1117,21 @@ prepare_and_execute_read_op(struct read_options* options,
             if (nullptr != options->span) {
                 req.parent_span = std::make_shared<pycbc::request_span>(options->span);
             }
+            if (options->conn->coalesce_reads_) {
+                do_coalesced_read(*(options->conn),
+                                  req,
+                                  options->op_type,
+                                  pyObj_callback,
+                                  pyObj_errback,
+                                  barrier,
+                                  multi_result,
+                                  batch,
+                                  false,
+                                  options->miss_errors);
+                break;
+            }
             do_get<couchbase::core::operations::exists_request>(
-              *(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result);
+              *(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result, batch, false, options->miss_errors);
             break;
         }
         case Operations::TOUCH: {
@@ -556,7 +1141,8 @@ prepare_and_execute_read_op(struct read_options* options,
             if (nullptr != options->span) {
                 req.parent_span = std::make_shared<pycbc::request_span>(options->span);
             }
-            do_get<couchbase::core::operations::touch_request>(*(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result);
+            do_get<couchbase::core::operations::touch_request>(
+              *(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result, batch);
             break;
         }
         case Operations::UNLOCK: {
@@ -567,66 +1153,27 @@ prepare_and_execute_read_op(struct read_options* options,
                 req.parent_span = std::make_shared<pycbc::request_span>(options->span);
             }
             do_get<couchbase::core::operations::unlock_request>(
-              *(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result);
+              *(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result, batch);
             break;
         }
         default: {
             if (multi_result != nullptr) {
                 PyObject* pyObj_exc =
                   pycbc_build_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Unrecognized get operation passed in.");
-                if (-1 == PyDict_SetItemString(multi_result->dict, options->id.key().c_str(), pyObj_exc)) {
-                    // TODO:  not much we can do here...maybe?
-                    PyErr_Print();
-                    PyErr_Clear();
-                }
-                Py_DECREF(pyObj_exc);
-                Py_INCREF(Py_False);
-                barrier->set_value(Py_False);
-                break;
-            } else {
-                if (barrier) {
-                    barrier->set_value(nullptr);
-                }
-                pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Unrecognized get operation passed in.");
-                Py_XDECREF(pyObj_callback);
-                Py_XDECREF(pyObj_errback);
-                return nullptr;
-            }
-        }
-    };
-    Py_RETURN_NONE;
-}
-
-template<typename Response>
-result*
-create_base_result_from_mutation_operation_response(const char* key, const Response& resp)
-{
-    PyObject* pyObj_result = create_result_obj();
-    result* res = reinterpret_cast<result*>(pyObj_result);
-    PyObject* pyObj_tmp = PyLong_FromUnsignedLongLong(resp.cas.value());
-    if (-1 == PyDict_SetItemString(res->dict, RESULT_CAS, pyObj_tmp)) {
-        Py_XDECREF(pyObj_tmp);
-        return nullptr;
-    }
-    Py_DECREF(pyObj_tmp);
-
-    if (nullptr != key) {
-        pyObj_tmp = PyUnicode_FromString(key);
-        if (-1 == PyDict_SetItemString(res->dict, RESULT_KEY, pyObj_tmp)) {
-            Py_XDECREF(pyObj_tmp);
-            return nullptr;
+                add_multi_op_result(multi_result, options->id.key().c_str(), pyObj_exc, false, barrier);
+                break;
+            } else {
+                if (barrier) {
+                    barrier->set_value(nullptr);
+                }
+                pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Unrecognized get operation passed in.");
+                Py_XDECREF(pyObj_callback);
+                Py_XDECREF(pyObj_errback);
+                return nullptr;
+            }
         }
-        Py_DECREF(pyObj_tmp);
-    }
-
-    PyObject* pyObj_mutation_token = create_mutation_token_obj(resp.token);
-    if (-1 == PyDict_SetItemString(res->dict, RESULT_MUTATION_TOKEN, pyObj_mutation_token)) {
-        Py_XDECREF(pyObj_mutation_token);
-        return nullptr;
-    }
-    Py_DECREF(pyObj_mutation_token);
-
-    return res;
+    };
+    Py_RETURN_NONE;
 }
 
 template<typename Response>
@@ -650,15 +1197,7 @@ create_result_from_mutation_operation_response(const char* key,
         pyObj_exc = build_exception_from_context(resp.ctx, __FILE__, __LINE__, "KV mutation operation error.");
         if (pyObj_errback == nullptr) {
             if (multi_result != nullptr) {
-                Py_INCREF(Py_False);
-                barrier->set_value(Py_False);
-                if (-1 == PyDict_SetItemString(multi_result->dict, key, pyObj_exc)) {
-                    // TODO:  not much we can do here...maybe?
-                    PyErr_Print();
-                    PyErr_Clear();
-                }
-                // won't fall into logic path where pyObj_exc is decremented later
-                Py_DECREF(pyObj_exc);
+                add_multi_op_result(multi_result, key, pyObj_exc, false, barrier);
             } else {
                 barrier->set_value(pyObj_exc);
             }
@@ -670,32 +1209,26 @@ create_result_from_mutation_operation_response(const char* key,
         // lets clear any errors
         PyErr_Clear();
     } else {
-        auto res = create_base_result_from_mutation_operation_response(key, resp);
-        if (res != nullptr) {
-            res->ec = resp.ctx.ec();
-            res = add_extras_to_result(resp, res);
-        }
-
-        if (res == nullptr || PyErr_Occurred() != nullptr) {
+        mutation_result_fields fields{};
+        fields.ec = resp.ctx.ec();
+        fields.cas = resp.cas.value();
+        fields.key = key;
+        fields.token = resp.token;
+        PyObject* pyObj_res = create_mutation_result_obj(std::move(fields));
+
+        if (pyObj_res == nullptr || PyErr_Occurred() != nullptr) {
             set_exception = true;
         } else {
             if (pyObj_callback == nullptr) {
                 if (multi_result != nullptr) {
-                    Py_INCREF(Py_True);
-                    barrier->set_value(Py_True);
-                    if (-1 == PyDict_SetItemString(multi_result->dict, key, reinterpret_cast<PyObject*>(res))) {
-                        // TODO:  not much we can do here...maybe?
-                        PyErr_Print();
-                        PyErr_Clear();
-                    }
-                    Py_DECREF(reinterpret_cast<PyObject*>(res));
+                    add_multi_op_result(multi_result, key, pyObj_res, true, barrier);
                 } else {
-                    barrier->set_value(reinterpret_cast<PyObject*>(res));
+                    barrier->set_value(pyObj_res);
                 }
             } else {
                 pyObj_func = pyObj_callback;
                 pyObj_args = PyTuple_New(1);
-                PyTuple_SET_ITEM(pyObj_args, 0, reinterpret_cast<PyObject*>(res));
+                PyTuple_SET_ITEM(pyObj_args, 0, pyObj_res);
             }
         }
     }
@@ -704,15 +1237,7 @@ create_result_from_mutation_operation_response(const char* key,
         pyObj_exc = pycbc_build_exception(PycbcError::UnableToBuildResult, __FILE__, __LINE__, "KV mutation operation error.");
         if (pyObj_errback == nullptr) {
             if (multi_result != nullptr) {
-                Py_INCREF(Py_False);
-                barrier->set_value(Py_False);
-                if (-1 == PyDict_SetItemString(multi_result->dict, key, pyObj_exc)) {
-                    // TODO:  not much we can do here...maybe?
-                    PyErr_Print();
-                    PyErr_Clear();
-                }
-                // won't fall into logic path where pyObj_exc is decremented later
-                Py_DECREF(pyObj_exc);
+                add_multi_op_result(multi_result, key, pyObj_exc, false, barrier);
             } else {
                 barrier->set_value(pyObj_exc);
             }
@@ -740,17 +1265,22 @@ create_result_from_mutation_operation_response(const char* key,
 template<typename Request>
 void
 do_mutation(connection& conn,
-            Request& req,
+            Request req,
             PyObject* pyObj_callback,
             PyObject* pyObj_errback,
             std::shared_ptr<std::promise<PyObject*>> barrier,
-            result* multi_result = nullptr)
+            result* multi_result = nullptr,
+            kv_batch* batch = nullptr)
 {
     using response_type = typename Request::response_type;
-    Py_BEGIN_ALLOW_THREADS conn.cluster_->execute(
-      req, [key = req.id.key(), pyObj_callback, pyObj_errback, barrier, multi_result](response_type resp) {
-          create_result_from_mutation_operation_response(key.c_str(), resp, pyObj_callback, pyObj_errback, barrier, multi_result);
-      });
+    auto handler = [key = req.id.key(), pyObj_callback, pyObj_errback, barrier, multi_result](response_type resp) {
+        create_result_from_mutation_operation_response(key.c_str(), resp, pyObj_callback, pyObj_errback, barrier, multi_result);
+    };
+    if (batch != nullptr) {
+        batch->add_mutation(conn, std::move(req), std::move(handler));
+        return;
+    }
+    Py_BEGIN_ALLOW_THREADS conn.execute_mutation(std::move(req), std::move(handler));
     Py_END_ALLOW_THREADS
 }
 
@@ -759,7 +1289,8 @@ prepare_and_execute_mutation_op(struct mutation_options* options,
                                 PyObject* pyObj_callback,
                                 PyObject* pyObj_errback,
                                 std::shared_ptr<std::promise<PyObject*>> barrier = nullptr,
-                                result* multi_result = nullptr)
+                                result* multi_result = nullptr,
+                                kv_batch* batch = nullptr)
 {
     // **DO NOT DECREF** these -- content from tuples are borrowed references!!
     PyObject* pyObj_flags = nullptr;
@@ -774,14 +1305,7 @@ prepare_and_execute_mutation_op(struct mutation_options* options,
         } catch (const std::exception& e) {
             if (multi_result != nullptr) {
                 PyObject* pyObj_exc = pycbc_build_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, e.what());
-                if (-1 == PyDict_SetItemString(multi_result->dict, options->id.key().c_str(), pyObj_exc)) {
-                    // TODO:  not much we can do here...maybe?
-                    PyErr_Print();
-                    PyErr_Clear();
-                }
-                Py_DECREF(pyObj_exc);
-                Py_INCREF(Py_False);
-                barrier->set_value(Py_False);
+                add_multi_op_result(multi_result, options->id.key().c_str(), pyObj_exc, false, barrier);
                 Py_RETURN_NONE;
             }
             if (barrier) {
@@ -798,7 +1322,7 @@ prepare_and_execute_mutation_op(struct mutation_options* options,
         case Operations::INSERT: {
             auto req = couchbase::core::operations::insert_request{ options->id };
             req.timeout = options->timeout_ms;
-            req.value = value;
+            req.value = std::move(value);
             req.flags = static_cast<uint32_t>(PyLong_AsLong(pyObj_flags));
             if (options->expiry > 0) {
                 req.expiry = options->expiry;
@@ -808,18 +1332,26 @@ prepare_and_execute_mutation_op(struct mutation_options* options,
             }
             if (options->use_legacy_durability) {
                 auto req_legacy_durability =
-                  couchbase::core::operations::insert_request_with_legacy_durability{ req, options->persist_to, options->replicate_to };
-                do_mutation(*(options->conn), req_legacy_durability, pyObj_callback, pyObj_errback, barrier, multi_result);
+                  couchbase::core::operations::insert_request_with_legacy_durability{
+                    std::move(req), options->persist_to, options->replicate_to
+                  };
+                do_mutation(*(options->conn),
+                            std::move(req_legacy_durability),
+                            pyObj_callback,
+                            pyObj_errback,
+                            barrier,
+                            multi_result,
+                            batch);
                 break;
             }
             req.durability_level = options->durability_level;
-            do_mutation(*(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result);
+            do_mutation(*(options->conn), std::move(req), pyObj_callback, pyObj_errback, barrier, multi_result, batch);
             break;
         }
         case Operations::UPSERT: {
             auto req = couchbase::core::operations::upsert_request{ options->id };
             req.timeout = options->timeout_ms;
-            req.value = value;
+            req.value = std::move(value);
             req.flags = static_cast<uint32_t>(PyLong_AsLong(pyObj_flags));
             if (options->expiry > 0) {
                 req.expiry = options->expiry;
@@ -832,19 +1364,27 @@ prepare_and_execute_mutation_op(struct mutation_options* options,
             }
             if (options->use_legacy_durability) {
                 auto req_legacy_durability =
-                  couchbase::core::operations::upsert_request_with_legacy_durability{ req, options->persist_to, options->replicate_to };
-                do_mutation(*(options->conn), req_legacy_durability, pyObj_callback, pyObj_errback, barrier, multi_result);
+                  couchbase::core::operations::upsert_request_with_legacy_durability{
+                    std::move(req), options->persist_to, options->replicate_to
+                  };
+                do_mutation(*(options->conn),
+                            std::move(req_legacy_durability),
+                            pyObj_callback,
+                            pyObj_errback,
+                            barrier,
+                            multi_result,
+                            batch);
                 break;
             }
             req.durability_level = options->durability_level;
-            do_mutation(*(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result);
+            do_mutation(*(options->conn), std::move(req), pyObj_callback, pyObj_errback, barrier, multi_result, batch);
             break;
         }
         case Operations::REPLACE: {
             auto req = couchbase::core::operations::replace_request{ options->id };
             req.timeout = options->timeout_ms;
             req.cas = options->cas;
-            req.value = value;
+            req.value = std::move(value);
             req.flags = static_cast<uint32_t>(PyLong_AsLong(pyObj_flags));
             if (options->expiry > 0) {
                 req.expiry = options->expiry;
@@ -857,12 +1397,20 @@ prepare_and_execute_mutation_op(struct mutation_options* options,
             }
             if (options->use_legacy_durability) {
                 auto req_legacy_durability =
-                  couchbase::core::operations::replace_request_with_legacy_durability{ req, options->persist_to, options->replicate_to };
-                do_mutation(*(options->conn), req_legacy_durability, pyObj_callback, pyObj_errback, barrier, multi_result);
+                  couchbase::core::operations::replace_request_with_legacy_durability{
+                    std::move(req), options->persist_to, options->replicate_to
+                  };
+                do_mutation(*(options->conn),
+                            std::move(req_legacy_durability),
+                            pyObj_callback,
+                            pyObj_errback,
+                            barrier,
+                            multi_result,
+                            batch);
                 break;
             }
             req.durability_level = options->durability_level;
-            do_mutation(*(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result);
+            do_mutation(*(options->conn), std::move(req), pyObj_callback, pyObj_errback, barrier, multi_result, batch);
             break;
         }
         case Operations::REMOVE: {
@@ -874,26 +1422,27 @@ prepare_and_execute_mutation_op(struct mutation_options* options,
             }
             if (options->use_legacy_durability) {
                 auto req_legacy_durability =
-                  couchbase::core::operations::remove_request_with_legacy_durability{ req, options->persist_to, options->replicate_to };
-                do_mutation(*(options->conn), req_legacy_durability, pyObj_callback, pyObj_errback, barrier, multi_result);
+                  couchbase::core::operations::remove_request_with_legacy_durability{
+                    std::move(req), options->persist_to, options->replicate_to
+                  };
+                do_mutation(*(options->conn),
+                            std::move(req_legacy_durability),
+                            pyObj_callback,
+                            pyObj_errback,
+                            barrier,
+                            multi_result,
+                            batch);
                 break;
             }
             req.durability_level = options->durability_level;
-            do_mutation(*(options->conn), req, pyObj_callback, pyObj_errback, barrier, multi_result);
+            do_mutation(*(options->conn), std::move(req), pyObj_callback, pyObj_errback, barrier, multi_result, batch);
             break;
         }
         default: {
             if (multi_result != nullptr) {
                 PyObject* pyObj_exc =
                   pycbc_build_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Unrecognized mutation operation passed in.");
-                if (-1 == PyDict_SetItemString(multi_result->dict, options->id.key().c_str(), pyObj_exc)) {
-                    // TODO:  not much we can do here...maybe?
-                    PyErr_Print();
-                    PyErr_Clear();
-                }
-                Py_DECREF(pyObj_exc);
-                Py_INCREF(Py_False);
-                barrier->set_value(Py_False);
+                add_multi_op_result(multi_result, options->id.key().c_str(), pyObj_exc, false, barrier);
                 break;
             }
 
@@ -955,6 +1504,14 @@ get_read_options(PyObject* op_args)
     PyObject* pyObj_with_expiry = PyDict_GetItemString(op_args, "with_expiry");
     opts.with_expiry = pyObj_with_expiry != nullptr && pyObj_with_expiry == Py_True ? true : false;
 
+    PyObject* pyObj_native_json = PyDict_GetItemString(op_args, "native_json");
+    opts.native_json = pyObj_native_json != nullptr && pyObj_native_json == Py_True ? true : false;
+
+    PyObject* pyObj_miss_errors = PyDict_GetItemString(op_args, "miss_errors");
+    if (pyObj_miss_errors != nullptr) {
+        opts.miss_errors = static_cast<std::uint8_t>(PyLong_AsUnsignedLong(pyObj_miss_errors));
+    }
+
     return opts;
 }
 
@@ -1156,10 +1713,11 @@ handle_kv_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kw
     char* collection = nullptr;
     Operations::OperationType op_type = Operations::UNKNOWN;
     PyObject* pyObj_op_args = nullptr;
+    int stream = 0;
 
-    static const char* kw_list[] = { "conn", "bucket", "scope", "collection_name", "op_type", "op_args", nullptr };
+    static const char* kw_list[] = { "conn", "bucket", "scope", "collection_name", "op_type", "op_args", "stream", nullptr };
 
-    const char* kw_format = "O!sssIO";
+    const char* kw_format = "O!sssIO|i";
     int ret = PyArg_ParseTupleAndKeywords(args,
                                           kwargs,
                                           kw_format,
@@ -1170,7 +1728,8 @@ handle_kv_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kw
                                           &scope,
                                           &collection,
                                           &op_type,
-                                          &pyObj_op_args);
+                                          &pyObj_op_args,
+                                          &stream);
     if (!ret) {
         pycbc_set_python_exception(
           PycbcError::InvalidArgument, __FILE__, __LINE__, "Cannot perform kv multi operation.  Unable to parse args/kwargs.");
@@ -1186,9 +1745,16 @@ handle_kv_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kw
     }
 
     std::vector<std::future<PyObject*>> op_results{};
+    kv_batch batch{};
 
     PyObject* pyObj_multi_result = create_result_obj();
     result* multi_result = reinterpret_cast<result*>(pyObj_multi_result);
+    std::chrono::milliseconds stream_timeout_ms{ 0 };
+    if (stream) {
+        // results are handed out in completion order, the extra pending count keeps the stream open until every key is dispatched
+        multi_result->stream = create_streamed_result_obj(couchbase::core::timeout_defaults::key_value_timeout);
+        multi_result->stream_pending = 1;
+    }
 
     if (pyObj_op_args && PyDict_Check(pyObj_op_args)) {
         PyObject *pyObj_doc_key, *pyObj_op_dict;
@@ -1203,7 +1769,13 @@ handle_kv_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kw
             }
             auto barrier = std::make_shared<std::promise<PyObject*>>();
             auto f = barrier->get_future();
-            if (PyDict_Check(pyObj_op_dict) && !k.empty()) {
+            if (stream) {
+                multi_result->stream_pending++;
+            }
+            if (!PyDict_Check(pyObj_op_dict) || k.empty()) {
+                PyObject* pyObj_exc = pycbc_build_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Invalid key or options.");
+                add_multi_op_result(multi_result, k.c_str(), pyObj_exc, false, barrier);
+            } else {
                 PyObject* pyObj_value = PyDict_GetItemString(pyObj_op_dict, "value");
 
                 switch (op_type) {
@@ -1213,6 +1785,7 @@ handle_kv_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kw
                     case Operations::REMOVE: {
                         auto opts = get_mutation_options(pyObj_op_dict);
                         opts.conn = conn;
+                        stream_timeout_ms = std::max(stream_timeout_ms, opts.timeout_ms);
                         opts.id = couchbase::core::document_id{ bucket, scope, collection, k };
                         opts.op_type = op_type;
                         if (pyObj_value != nullptr) {
@@ -1220,10 +1793,10 @@ handle_kv_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kw
                         }
 
                         try {
-                            pyObj_op_response = prepare_and_execute_mutation_op(&opts, nullptr, nullptr, barrier, multi_result);
+                            pyObj_op_response = prepare_and_execute_mutation_op(&opts, nullptr, nullptr, barrier, multi_result, &batch);
                         } catch (const std::system_error& e) {
                             PyObject* pyObj_exc = pycbc_build_exception(e.code(), __FILE__, __LINE__, e.what());
-                            barrier->set_value(pyObj_exc);
+                            add_multi_op_result(multi_result, k.c_str(), pyObj_exc, false, barrier);
                         }
                         break;
                     }
@@ -1238,6 +1811,7 @@ handle_kv_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kw
                     case Operations::UNLOCK: {
                         auto opts = get_read_options(pyObj_op_dict);
                         opts.conn = conn;
+                        stream_timeout_ms = std::max(stream_timeout_ms, opts.timeout_ms);
                         opts.id = couchbase::core::document_id{ bucket, scope, collection, k };
                         PyObject* pyObj_project = PyDict_GetItemString(pyObj_op_dict, "project");
                         if (pyObj_project != nullptr || opts.with_expiry) {
@@ -1246,17 +1820,17 @@ handle_kv_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kw
                         }
                         opts.op_type = op_type;
                         try {
-                            pyObj_op_response = prepare_and_execute_read_op(&opts, nullptr, nullptr, barrier, multi_result);
+                            pyObj_op_response = prepare_and_execute_read_op(&opts, nullptr, nullptr, barrier, multi_result, &batch);
                         } catch (const std::system_error& e) {
                             PyObject* pyObj_exc = pycbc_build_exception(e.code(), __FILE__, __LINE__, e.what());
-                            barrier->set_value(pyObj_exc);
+                            add_multi_op_result(multi_result, k.c_str(), pyObj_exc, false, barrier);
                         }
                         break;
                     }
                     default: {
                         PyObject* pyObj_exc =
                           pycbc_build_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Unrecognized KV operation passed in.");
-                        barrier->set_value(pyObj_exc);
+                        add_multi_op_result(multi_result, k.c_str(), pyObj_exc, false, barrier);
                         break;
                     }
                 };
@@ -1267,12 +1841,31 @@ handle_kv_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kw
         }
     }
 
-    auto all_okay = true;
-    for (auto i = 0; i < op_results.size(); i++) {
-        PyObject* res = nullptr;
-        Py_BEGIN_ALLOW_THREADS res = op_results[i].get();
-        Py_END_ALLOW_THREADS if (res == Py_False)
+    batch.submit();
+
+    if (stream) {
+        auto* pyObj_stream = multi_result->stream;
+        pyObj_stream->timeout_ms = std::max(stream_timeout_ms, couchbase::core::timeout_defaults::key_value_timeout);
+        Py_INCREF(reinterpret_cast<PyObject*>(pyObj_stream));
+        // everything is dispatched, drop the guard so the last completion closes the stream
+        release_multi_op_stream(multi_result);
+        return reinterpret_cast<PyObject*>(pyObj_stream);
+    }
+
+    // wait for the whole batch w/in a single GIL release, the results are only touched once the GIL is held again
+    std::vector<PyObject*> results{};
+    results.reserve(op_results.size());
+    {
+        Py_BEGIN_ALLOW_THREADS for (auto& f : op_results)
         {
+            results.push_back(f.get());
+        }
+        Py_END_ALLOW_THREADS
+    }
+
+    auto all_okay = true;
+    for (auto* res : results) {
+        if (res == Py_False) {
             all_okay = false;
         }
         Py_XDECREF(res);
@@ -1286,3 +1879,575 @@ handle_kv_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kw
 
     return reinterpret_cast<PyObject*>(multi_result);
 }
+
+namespace
+{
+PyObject*
+build_bulk_counters(std::uint64_t submitted, std::uint64_t succeeded, std::uint64_t failed, std::uint64_t bytes)
+{
+    return Py_BuildValue("{sKsKsKsK}",
+                         "submitted",
+                         static_cast<unsigned long long>(submitted),
+                         "succeeded",
+                         static_cast<unsigned long long>(succeeded),
+                         "failed",
+                         static_cast<unsigned long long>(failed),
+                         "bytes",
+                         static_cast<unsigned long long>(bytes));
+}
+
+// size of an encoded value as PyObject_to_binary() will read it, zero if it is not a buffer (the op then fails)
+Py_ssize_t
+encoded_value_size(PyObject* pyObj_data)
+{
+    if (PyBytes_Check(pyObj_data)) {
+        return PyBytes_GET_SIZE(pyObj_data);
+    }
+    Py_buffer view;
+    if (PyObject_GetBuffer(pyObj_data, &view, PyBUF_SIMPLE) == -1) {
+        PyErr_Clear();
+        return 0;
+    }
+    auto len = view.len;
+    PyBuffer_Release(&view);
+    return len;
+}
+} // namespace
+
+PyObject*
+handle_kv_bulk_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kwargs)
+{
+    PyObject* pyObj_conn = nullptr;
+    char* bucket = nullptr;
+    char* scope = nullptr;
+    char* collection = nullptr;
+    Operations::OperationType op_type = Operations::UNKNOWN;
+    PyObject* pyObj_docs = nullptr;
+    Py_ssize_t max_in_flight = 128;
+    Py_ssize_t max_bytes = 0;
+    PyObject* pyObj_error_sink = nullptr;
+    PyObject* pyObj_progress = nullptr;
+
+    static const char* kw_list[] = { "conn",          "bucket",    "scope",      "collection_name", "op_type", "docs",
+                                     "max_in_flight", "max_bytes", "error_sink", "progress",        nullptr };
+
+    const char* kw_format = "O!sssIO|nnOO";
+    int ret = PyArg_ParseTupleAndKeywords(args,
+                                          kwargs,
+                                          kw_format,
+                                          const_cast<char**>(kw_list),
+                                          &PyCapsule_Type,
+                                          &pyObj_conn,
+                                          &bucket,
+                                          &scope,
+                                          &collection,
+                                          &op_type,
+                                          &pyObj_docs,
+                                          &max_in_flight,
+                                          &max_bytes,
+                                          &pyObj_error_sink,
+                                          &pyObj_progress);
+    if (!ret) {
+        pycbc_set_python_exception(
+          PycbcError::InvalidArgument, __FILE__, __LINE__, "Cannot perform kv bulk operation.  Unable to parse args/kwargs.");
+        return nullptr;
+    }
+
+    if (op_type != Operations::INSERT && op_type != Operations::UPSERT && op_type != Operations::REPLACE &&
+        op_type != Operations::REMOVE) {
+        pycbc_set_python_exception(
+          PycbcError::InvalidArgument, __FILE__, __LINE__, "Bulk operations only support INSERT, UPSERT, REPLACE and REMOVE.");
+        return nullptr;
+    }
+
+    if (max_in_flight <= 0) {
+        pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "max_in_flight must be greater than 0.");
+        return nullptr;
+    }
+
+    if (pyObj_error_sink == Py_None) {
+        pyObj_error_sink = nullptr;
+    }
+    if (pyObj_progress == Py_None) {
+        pyObj_progress = nullptr;
+    }
+
+    connection* conn = nullptr;
+
+    conn = reinterpret_cast<connection*>(PyCapsule_GetPointer(pyObj_conn, "conn_"));
+    if (nullptr == conn) {
+        pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, NULL_CONN_OBJECT);
+        return nullptr;
+    }
+
+    PyObject* pyObj_iter = PyObject_GetIter(pyObj_docs);
+    if (pyObj_iter == nullptr) {
+        return nullptr;
+    }
+
+    // completions are handed back through a multi op stream, the window is refilled as they are pulled off
+    PyObject* pyObj_multi_result = create_result_obj();
+    result* multi_result = reinterpret_cast<result*>(pyObj_multi_result);
+    multi_result->stream = create_streamed_result_obj(couchbase::core::timeout_defaults::key_value_timeout);
+    multi_result->stream_pending = 1;
+    streamed_result* stream = multi_result->stream;
+    Py_INCREF(reinterpret_cast<PyObject*>(stream));
+
+    std::uint64_t submitted = 0;
+    std::uint64_t succeeded = 0;
+    std::uint64_t failed = 0;
+    std::uint64_t bytes = 0;
+    Py_ssize_t in_flight = 0;
+    Py_ssize_t bytes_in_flight = 0;
+    std::unordered_multimap<std::string, Py_ssize_t> in_flight_sizes{};
+    std::chrono::milliseconds wait_timeout_ms = couchbase::core::timeout_defaults::key_value_timeout;
+
+    // set when the iterator or one of the callbacks raised, nothing new is submitted but in-flight ops are drained
+    PyObject* pyObj_err_type = nullptr;
+    PyObject* pyObj_err_value = nullptr;
+    PyObject* pyObj_err_traceback = nullptr;
+    auto stop_on_error = [&]() {
+        if (pyObj_err_type == nullptr) {
+            PyErr_Fetch(&pyObj_err_type, &pyObj_err_value, &pyObj_err_traceback);
+        } else {
+            PyErr_Clear();
+        }
+    };
+
+    bool exhausted = false;
+    kv_batch batch{};
+    while (true) {
+        while (!exhausted && pyObj_err_type == nullptr && in_flight < max_in_flight && (max_bytes <= 0 || bytes_in_flight < max_bytes)) {
+            PyObject* pyObj_item = PyIter_Next(pyObj_iter);
+            if (pyObj_item == nullptr) {
+                exhausted = true;
+                if (PyErr_Occurred()) {
+                    stop_on_error();
+                }
+                break;
+            }
+
+            PyObject* pyObj_key = nullptr;
+            PyObject* pyObj_op_dict = nullptr;
+            if (!PyTuple_Check(pyObj_item) || PyTuple_GET_SIZE(pyObj_item) != 2 || !PyUnicode_Check(PyTuple_GET_ITEM(pyObj_item, 0)) ||
+                !PyDict_Check(PyTuple_GET_ITEM(pyObj_item, 1))) {
+                Py_DECREF(pyObj_item);
+                pycbc_set_python_exception(
+                  PycbcError::InvalidArgument, __FILE__, __LINE__, "Bulk operation documents must be (key, options) tuples.");
+                stop_on_error();
+                break;
+            }
+            pyObj_key = PyTuple_GET_ITEM(pyObj_item, 0);
+            pyObj_op_dict = PyTuple_GET_ITEM(pyObj_item, 1);
+
+            std::string k = std::string(PyUnicode_AsUTF8(pyObj_key));
+            auto opts = get_mutation_options(pyObj_op_dict);
+            opts.conn = conn;
+            opts.id = couchbase::core::document_id{ bucket, scope, collection, k };
+            opts.op_type = op_type;
+            PyObject* pyObj_value = PyDict_GetItemString(pyObj_op_dict, "value");
+            Py_ssize_t nbytes = static_cast<Py_ssize_t>(k.size());
+            if (pyObj_value != nullptr) {
+                opts.value = pyObj_value;
+                PyObject* pyObj_data = PyTuple_Check(pyObj_value) ? PyTuple_GET_ITEM(pyObj_value, 0) : nullptr;
+                if (pyObj_data != nullptr) {
+                    nbytes += encoded_value_size(pyObj_data);
+                }
+            }
+            wait_timeout_ms = std::max(wait_timeout_ms, opts.timeout_ms);
+
+            in_flight++;
+            bytes_in_flight += nbytes;
+            in_flight_sizes.emplace(k, nbytes);
+            submitted++;
+            bytes += static_cast<std::uint64_t>(nbytes);
+            multi_result->stream_pending++;
+
+            auto barrier = std::make_shared<std::promise<PyObject*>>();
+            PyObject* pyObj_op_response = nullptr;
+            try {
+                pyObj_op_response = prepare_and_execute_mutation_op(&opts, nullptr, nullptr, barrier, multi_result, &batch);
+            } catch (const std::system_error& e) {
+                PyObject* pyObj_exc = pycbc_build_exception(e.code(), __FILE__, __LINE__, e.what());
+                add_multi_op_result(multi_result, k.c_str(), pyObj_exc, false, barrier);
+            }
+            Py_XDECREF(pyObj_op_response);
+            Py_DECREF(pyObj_item);
+        }
+        batch.submit();
+
+        if (in_flight == 0) {
+            break;
+        }
+
+        // block for the next completion, then take whatever else has already completed
+        PyObject* pyObj_row = nullptr;
+        {
+            Py_BEGIN_ALLOW_THREADS pyObj_row = stream->rows->get(wait_timeout_ms);
+            Py_END_ALLOW_THREADS
+        }
+        if (pyObj_row == nullptr) {
+            // every op carries its own timeout, so this only happens if the completions stopped flowing
+            pycbc_set_python_exception(
+              PycbcError::UnsuccessfulOperation, __FILE__, __LINE__, "Timeout reached waiting for bulk operation completions.");
+            stop_on_error();
+            break;
+        }
+        while (pyObj_row != nullptr) {
+            PyObject* pyObj_row_key = PyTuple_GET_ITEM(pyObj_row, 0);
+            PyObject* pyObj_row_value = PyTuple_GET_ITEM(pyObj_row, 1);
+            auto entry = in_flight_sizes.find(std::string(PyUnicode_AsUTF8(pyObj_row_key)));
+            if (entry != in_flight_sizes.end()) {
+                bytes_in_flight -= entry->second;
+                in_flight_sizes.erase(entry);
+            }
+            in_flight--;
+            if (PyObject_TypeCheck(pyObj_row_value, &exception_base_type)) {
+                failed++;
+                if (pyObj_error_sink != nullptr && pyObj_err_type == nullptr) {
+                    PyObject* pyObj_sink_res = PyObject_CallFunctionObjArgs(pyObj_error_sink, pyObj_row_key, pyObj_row_value, nullptr);
+                    if (pyObj_sink_res == nullptr) {
+                        stop_on_error();
+                    }
+                    Py_XDECREF(pyObj_sink_res);
+                }
+            } else {
+                succeeded++;
+            }
+            Py_DECREF(pyObj_row);
+            pyObj_row = stream->rows->get(std::chrono::milliseconds(0));
+        }
+
+        if (pyObj_progress != nullptr && pyObj_err_type == nullptr) {
+            PyObject* pyObj_counters = build_bulk_counters(submitted, succeeded, failed, bytes);
+            PyObject* pyObj_progress_res = PyObject_CallFunctionObjArgs(pyObj_progress, pyObj_counters, nullptr);
+            if (pyObj_progress_res == nullptr) {
+                stop_on_error();
+            }
+            Py_XDECREF(pyObj_progress_res);
+            Py_XDECREF(pyObj_counters);
+        }
+    }
+
+    // drop the dispatch guard, if anything is still in flight the last completion releases the multi op result
+    release_multi_op_stream(multi_result);
+    Py_DECREF(reinterpret_cast<PyObject*>(stream));
+    Py_DECREF(pyObj_iter);
+
+    if (pyObj_err_type != nullptr) {
+        PyErr_Restore(pyObj_err_type, pyObj_err_value, pyObj_err_traceback);
+        return nullptr;
+    }
+
+    return build_bulk_counters(submitted, succeeded, failed, bytes);
+}
+
+PyTypeObject kv_handle_type = { PyObject_HEAD_INIT(NULL) 0 };
+
+static PyObject*
+kv_handle_new(PyTypeObject* type, PyObject* args, PyObject* kwargs)
+{
+    PyObject* pyObj_conn = nullptr;
+    char* bucket = nullptr;
+    char* scope = nullptr;
+    char* collection = nullptr;
+    static const char* kw_list[] = { "conn", "bucket", "scope", "collection_name", nullptr };
+    if (!PyArg_ParseTupleAndKeywords(
+          args, kwargs, "O!sss", const_cast<char**>(kw_list), &PyCapsule_Type, &pyObj_conn, &bucket, &scope, &collection)) {
+        pycbc_set_python_exception(
+          PycbcError::InvalidArgument, __FILE__, __LINE__, "Cannot create kv handle.  Unable to parse args/kwargs.");
+        return nullptr;
+    }
+
+    auto* conn = reinterpret_cast<connection*>(PyCapsule_GetPointer(pyObj_conn, "conn_"));
+    if (nullptr == conn) {
+        pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, NULL_CONN_OBJECT);
+        return nullptr;
+    }
+
+    auto* self = reinterpret_cast<kv_handle*>(type->tp_alloc(type, 0));
+    if (self == nullptr) {
+        return nullptr;
+    }
+    // the capsule owns the connection, hold on to it for as long as the handle is around
+    Py_INCREF(pyObj_conn);
+    self->pyObj_conn = pyObj_conn;
+    self->conn = conn;
+    new (&self->bucket) std::string{ bucket };
+    new (&self->scope) std::string{ scope };
+    new (&self->collection) std::string{ collection };
+    return reinterpret_cast<PyObject*>(self);
+}
+
+static void
+kv_handle_dealloc(kv_handle* self)
+{
+    Py_XDECREF(self->pyObj_conn);
+    std::destroy_at(&self->bucket);
+    std::destroy_at(&self->scope);
+    std::destroy_at(&self->collection);
+    Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
+}
+
+/**
+ * Checks the positional arg count of a kv_handle method and builds the document id from the key (always the
+ * first arg).  Timeouts are in microseconds, same as the op_args timeout, 0 or None for the default.  Returns
+ * false, w/ the Python exception set, on failure.
+ */
+static bool
+kv_handle_parse_args(kv_handle* self,
+                     const char* name,
+                     PyObject* const* args,
+                     Py_ssize_t nargs,
+                     Py_ssize_t min_args,
+                     Py_ssize_t max_args,
+                     couchbase::core::document_id& id)
+{
+    if (nargs < min_args || nargs > max_args) {
+        pycbc_set_python_exception(PycbcError::InvalidArgument,
+                                   __FILE__,
+                                   __LINE__,
+                                   fmt::format("{}() takes {} to {} positional arguments, got {}.", name, min_args, max_args, nargs)
+                                     .c_str());
+        return false;
+    }
+    Py_ssize_t key_len = 0;
+    const char* key = PyUnicode_Check(args[0]) ? PyUnicode_AsUTF8AndSize(args[0], &key_len) : nullptr;
+    if (key == nullptr) {
+        PyErr_Clear();
+        pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Expected key to be a str.");
+        return false;
+    }
+    id = couchbase::core::document_id{ self->bucket, self->scope, self->collection, std::string{ key, static_cast<std::size_t>(key_len) } };
+    return true;
+}
+
+static bool
+kv_handle_parse_uint(PyObject* const* args, Py_ssize_t nargs, Py_ssize_t idx, const char* name, std::uint64_t& value)
+{
+    value = 0;
+    if (idx >= nargs || args[idx] == Py_None) {
+        return true;
+    }
+    if (!PyLong_Check(args[idx])) {
+        pycbc_set_python_exception(
+          PycbcError::InvalidArgument, __FILE__, __LINE__, fmt::format("Expected {} to be an int.", name).c_str());
+        return false;
+    }
+    value = static_cast<std::uint64_t>(PyLong_AsUnsignedLongLong(args[idx]));
+    if (PyErr_Occurred()) {
+        PyErr_Clear();
+        pycbc_set_python_exception(
+          PycbcError::InvalidArgument, __FILE__, __LINE__, fmt::format("Expected {} to be a non-negative int.", name).c_str());
+        return false;
+    }
+    return true;
+}
+
+template<typename Options>
+static bool
+kv_handle_parse_timeout(PyObject* const* args, Py_ssize_t nargs, Options& opts)
+{
+    std::uint64_t timeout = 0;
+    if (!kv_handle_parse_uint(args, nargs, 1, "timeout", timeout)) {
+        return false;
+    }
+    if (0 < timeout) {
+        opts.timeout_ms = std::chrono::milliseconds(timeout / 1000ULL);
+    }
+    return true;
+}
+
+static PyObject*
+kv_handle_execute_read(read_options& opts)
+{
+    auto barrier = std::make_shared<std::promise<PyObject*>>();
+    auto fut = barrier->get_future();
+    try {
+        prepare_and_execute_read_op(&opts, nullptr, nullptr, barrier);
+    } catch (const std::system_error& e) {
+        barrier->set_value(nullptr);
+        pycbc_set_python_exception(e.code(), __FILE__, __LINE__, e.what());
+    }
+    PyObject* ret = nullptr;
+    Py_BEGIN_ALLOW_THREADS ret = fut.get();
+    Py_END_ALLOW_THREADS return ret;
+}
+
+static PyObject*
+kv_handle_execute_mutation(mutation_options& opts)
+{
+    auto barrier = std::make_shared<std::promise<PyObject*>>();
+    auto fut = barrier->get_future();
+    try {
+        prepare_and_execute_mutation_op(&opts, nullptr, nullptr, barrier);
+    } catch (const std::system_error& e) {
+        barrier->set_value(nullptr);
+        pycbc_set_python_exception(e.code(), __FILE__, __LINE__, e.what());
+    }
+    PyObject* ret = nullptr;
+    Py_BEGIN_ALLOW_THREADS ret = fut.get();
+    Py_END_ALLOW_THREADS return ret;
+}
+
+// get(key, timeout=0, native_json=False)
+static PyObject*
+kv_handle__get__(kv_handle* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    read_options opts{};
+    if (!kv_handle_parse_args(self, "get", args, nargs, 1, 3, opts.id) || !kv_handle_parse_timeout(args, nargs, opts)) {
+        return nullptr;
+    }
+    opts.conn = self->conn;
+    opts.op_type = Operations::GET;
+    opts.native_json = nargs > 2 && PyObject_IsTrue(args[2]) == 1;
+    return kv_handle_execute_read(opts);
+}
+
+// exists(key, timeout=0)
+static PyObject*
+kv_handle__exists__(kv_handle* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    read_options opts{};
+    if (!kv_handle_parse_args(self, "exists", args, nargs, 1, 2, opts.id) || !kv_handle_parse_timeout(args, nargs, opts)) {
+        return nullptr;
+    }
+    opts.conn = self->conn;
+    opts.op_type = Operations::EXISTS;
+    return kv_handle_execute_read(opts);
+}
+
+// upsert/insert/replace(key, (value, flags), timeout=0, expiry=0[, cas=0]), cas is only taken by replace
+static PyObject*
+kv_handle_store(kv_handle* self, Operations::OperationType op_type, const char* name, PyObject* const* args, Py_ssize_t nargs)
+{
+    mutation_options opts{};
+    auto max_args = op_type == Operations::REPLACE ? 5 : 4;
+    if (!kv_handle_parse_args(self, name, args, nargs, 2, max_args, opts.id)) {
+        return nullptr;
+    }
+    if (!PyTuple_Check(args[1]) || PyTuple_GET_SIZE(args[1]) != 2) {
+        pycbc_set_python_exception(
+          PycbcError::InvalidArgument, __FILE__, __LINE__, "Expected value to be an encoded (value, flags) tuple.");
+        return nullptr;
+    }
+    // the timeout follows the value for mutations
+    std::uint64_t timeout = 0;
+    std::uint64_t expiry = 0;
+    std::uint64_t cas = 0;
+    if (!kv_handle_parse_uint(args, nargs, 2, "timeout", timeout) || !kv_handle_parse_uint(args, nargs, 3, "expiry", expiry) ||
+        !kv_handle_parse_uint(args, nargs, 4, "cas", cas)) {
+        return nullptr;
+    }
+    opts.conn = self->conn;
+    opts.op_type = op_type;
+    opts.value = args[1];
+    opts.expiry = static_cast<std::uint32_t>(expiry);
+    opts.cas = couchbase::cas{ cas };
+    if (0 < timeout) {
+        opts.timeout_ms = std::chrono::milliseconds(timeout / 1000ULL);
+    }
+    return kv_handle_execute_mutation(opts);
+}
+
+static PyObject*
+kv_handle__upsert__(kv_handle* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    return kv_handle_store(self, Operations::UPSERT, "upsert", args, nargs);
+}
+
+static PyObject*
+kv_handle__insert__(kv_handle* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    return kv_handle_store(self, Operations::INSERT, "insert", args, nargs);
+}
+
+static PyObject*
+kv_handle__replace__(kv_handle* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    return kv_handle_store(self, Operations::REPLACE, "replace", args, nargs);
+}
+
+// remove(key, timeout=0, cas=0)
+static PyObject*
+kv_handle__remove__(kv_handle* self, PyObject* const* args, Py_ssize_t nargs)
+{
+    mutation_options opts{};
+    if (!kv_handle_parse_args(self, "remove", args, nargs, 1, 3, opts.id) || !kv_handle_parse_timeout(args, nargs, opts)) {
+        return nullptr;
+    }
+    std::uint64_t cas = 0;
+    if (!kv_handle_parse_uint(args, nargs, 2, "cas", cas)) {
+        return nullptr;
+    }
+    opts.conn = self->conn;
+    opts.op_type = Operations::REMOVE;
+    opts.cas = couchbase::cas{ cas };
+    return kv_handle_execute_mutation(opts);
+}
+
+static PyObject*
+kv_handle__bucket__(kv_handle* self, [[maybe_unused]] void* closure)
+{
+    return PyUnicode_FromStringAndSize(self->bucket.data(), static_cast<Py_ssize_t>(self->bucket.size()));
+}
+
+static PyObject*
+kv_handle__scope__(kv_handle* self, [[maybe_unused]] void* closure)
+{
+    return PyUnicode_FromStringAndSize(self->scope.data(), static_cast<Py_ssize_t>(self->scope.size()));
+}
+
+static PyObject*
+kv_handle__collection_name__(kv_handle* self, [[maybe_unused]] void* closure)
+{
+    return PyUnicode_FromStringAndSize(self->collection.data(), static_cast<Py_ssize_t>(self->collection.size()));
+}
+
+static PyMethodDef kv_handle_methods[] = {
+    { "get", (PyCFunction)(void (*)(void))kv_handle__get__, METH_FASTCALL, PyDoc_STR("get(key, timeout=0, native_json=False)") },
+    { "exists", (PyCFunction)(void (*)(void))kv_handle__exists__, METH_FASTCALL, PyDoc_STR("exists(key, timeout=0)") },
+    { "upsert",
+      (PyCFunction)(void (*)(void))kv_handle__upsert__,
+      METH_FASTCALL,
+      PyDoc_STR("upsert(key, (value, flags), timeout=0, expiry=0)") },
+    { "insert",
+      (PyCFunction)(void (*)(void))kv_handle__insert__,
+      METH_FASTCALL,
+      PyDoc_STR("insert(key, (value, flags), timeout=0, expiry=0)") },
+    { "replace",
+      (PyCFunction)(void (*)(void))kv_handle__replace__,
+      METH_FASTCALL,
+      PyDoc_STR("replace(key, (value, flags), timeout=0, expiry=0, cas=0)") },
+    { "remove", (PyCFunction)(void (*)(void))kv_handle__remove__, METH_FASTCALL, PyDoc_STR("remove(key, timeout=0, cas=0)") },
+    { NULL, NULL, 0, NULL }
+};
+
+static PyGetSetDef kv_handle_getset[] = {
+    { "bucket", (getter)kv_handle__bucket__, nullptr, PyDoc_STR("Bucket the handle is bound to"), nullptr },
+    { "scope", (getter)kv_handle__scope__, nullptr, PyDoc_STR("Scope the handle is bound to"), nullptr },
+    { "collection_name", (getter)kv_handle__collection_name__, nullptr, PyDoc_STR("Collection the handle is bound to"), nullptr },
+    { NULL }
+};
+
+int
+pycbc_kv_handle_type_init(PyObject** ptr)
+{
+    PyTypeObject* p = &kv_handle_type;
+
+    *ptr = (PyObject*)p;
+    if (p->tp_name) {
+        return 0;
+    }
+
+    p->tp_name = "pycbc_core.kv_handle";
+    p->tp_doc = "KV operations bound to a collection";
+    p->tp_basicsize = sizeof(kv_handle);
+    p->tp_flags = Py_TPFLAGS_DEFAULT;
+    p->tp_new = kv_handle_new;
+    p->tp_dealloc = (destructor)kv_handle_dealloc;
+    p->tp_methods = kv_handle_methods;
+    p->tp_getset = kv_handle_getset;
+
+    return PyType_Ready(p);
+}
@@ -26,11 +26,22 @@
 #include <couchbase/upsert_options.hxx>
 #include <couchbase/persist_to.hxx>
 #include <couchbase/replicate_to.hxx>
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <unordered_map>
 
 /**
  * GET, GET_PROJECTED, GET_AND_LOCK, GET_AND_TOUCH
  * EXISTS, TOUCH, UNLOCK
  */
+// errors a read can report w/ a miss_result instead of an exception, see read_options::miss_errors
+enum read_miss : std::uint8_t {
+    read_miss_not_found = 0x01,
+    read_miss_cas_mismatch = 0x02,
+    read_miss_locked = 0x04,
+};
+
 struct read_options {
     // common - required
     connection* conn;
@@ -47,6 +58,10 @@ struct read_options {
     couchbase::cas cas;
     PyObject* span{ nullptr };
     PyObject* project{ nullptr };
+    // parse JSON documents on the IO thread and return the decoded value
+    bool native_json{ false };
+    // read_miss flags, matching failures are returned as a miss_result instead of an exception
+    std::uint8_t miss_errors{ 0 };
 
     // TODO:
     // retries?
@@ -82,12 +97,133 @@ struct mutation_options {
     // durability_timeout
 };
 
+/**
+ * Requests of a multi operation are collected here while the op dict is parsed (with the GIL held) and then
+ * submitted in one go, with the GIL released once.  W/ io_sharding the requests are grouped by the shard that
+ * owns each key, so each shard's IO thread gets its requests back to back.  Otherwise they are submitted in the
+ * order they were added: requests are not grouped by the node owning the key's vbucket, which only the core
+ * knows, and what is saved is the GIL round trip per request.
+ */
+class kv_batch
+{
+  public:
+    template<typename Request, typename Handler>
+    void add(connection& conn, Request req, Handler&& handler)
+    {
+        auto* shard = conn.shard_for(req.id);
+        ops_.push_back({ shard, [&conn, req = std::move(req), handler = std::forward<Handler>(handler)]() mutable {
+                            conn.execute(std::move(req), std::move(handler));
+                        } });
+    }
+
+    template<typename Request, typename Handler>
+    void add_mutation(connection& conn, Request req, Handler&& handler)
+    {
+        auto* shard = conn.shard_for(req.id);
+        ops_.push_back({ shard, [&conn, req = std::move(req), handler = std::forward<Handler>(handler)]() mutable {
+                            conn.execute_mutation(std::move(req), std::move(handler));
+                        } });
+    }
+
+    template<typename Request, typename Handler, typename Prepare>
+    void add_mutation(connection& conn, Request req, Handler&& handler, Prepare&& prepare)
+    {
+        auto* shard = conn.shard_for(req.id);
+        ops_.push_back({ shard,
+                         [&conn,
+                          req = std::move(req),
+                          handler = std::forward<Handler>(handler),
+                          prepare = std::forward<Prepare>(prepare)]() mutable {
+                             conn.execute_mutation(std::move(req), std::move(handler), std::move(prepare));
+                         } });
+    }
+
+    template<typename Request, typename Handler, typename Prepare>
+    void add(connection& conn, Request req, Handler&& handler, Prepare&& prepare)
+    {
+        auto* shard = conn.shard_for(req.id);
+        ops_.push_back({ shard,
+                         [&conn,
+                          req = std::move(req),
+                          handler = std::forward<Handler>(handler),
+                          prepare = std::forward<Prepare>(prepare)]() mutable {
+                             conn.execute(std::move(req), std::move(handler), std::move(prepare));
+                         } });
+    }
+
+    // submit() runs in line w/ the other requests of the batch (w/o the GIL), for requests that start more than
+    // the request itself when they are sent (e.g. the timer of a hedged read)
+    void add_submit(io_shard* shard, std::function<void()> submit)
+    {
+        ops_.push_back({ shard, std::move(submit) });
+    }
+
+    std::size_t size() const
+    {
+        return ops_.size();
+    }
+
+    // must be called w/ the GIL held
+    void submit()
+    {
+        // w/o io_sharding all shards are null and there is nothing to group
+        if (!ops_.empty() && ops_.front().shard != nullptr) {
+            std::stable_sort(
+              ops_.begin(), ops_.end(), [](const pending_op& lhs, const pending_op& rhs) { return std::less<>{}(lhs.shard, rhs.shard); });
+        }
+        {
+            Py_BEGIN_ALLOW_THREADS for (auto& op : ops_)
+            {
+                op.submit();
+            }
+            Py_END_ALLOW_THREADS
+        }
+        ops_.clear();
+    }
+
+  private:
+    struct pending_op {
+        io_shard* shard;
+        std::function<void()> submit;
+    };
+    std::vector<pending_op> ops_{};
+};
+
+/**
+ * pycbc_core.kv_handle: a collection's connection and keyspace bound once, w/ positional (METH_FASTCALL) entry
+ * points for the plain KV operations.  Calls skip the kwargs and op_args dict parsing kv_operation does, the
+ * options that are not taken positionally (durability, projections, spans, ...) go through kv_operation.
+ */
+struct kv_handle {
+    PyObject_HEAD PyObject* pyObj_conn;
+    connection* conn;
+    std::string bucket;
+    std::string scope;
+    std::string collection;
+};
+
+int
+pycbc_kv_handle_type_init(PyObject** ptr);
+
+extern PyTypeObject kv_handle_type;
+
 PyObject*
 handle_kv_op(PyObject* self, PyObject* args, PyObject* kwargs);
 
 PyObject*
 handle_kv_multi_op(PyObject* self, PyObject* args, PyObject* kwargs);
 
+/**
+ * Feed mutations from an iterator of (key, op_args) tuples while keeping at most max_in_flight operations
+ * (and, if set, max_bytes of key + encoded value) outstanding.  Failed keys are handed to error_sink(key, exc)
+ * and the run continues, progress(counters) is called after each batch of completions.
+ *
+ * The window is global to the run: which node owns a key is only known to the core, so there is no per node
+ * window and a slow node can hold the whole window.
+ */
+PyObject*
+handle_kv_bulk_op(PyObject* self, PyObject* args, PyObject* kwargs);
+
 PyObject*
 handle_kv_blocking_result(std::future<PyObject*>&& fut);
 
@@ -0,0 +1,624 @@
+/*
+ *   Copyright 2016-2022. Couchbase, Inc.
+ *   All Rights Reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#include "kv_result.hxx"
+#include "result.hxx"
+#include "utils.hxx"
+#include <cstring>
+#include <new>
+
+PyTypeObject get_result_type = { PyObject_HEAD_INIT(NULL) 0 };
+PyTypeObject mutation_result_type = { PyObject_HEAD_INIT(NULL) 0 };
+PyTypeObject exists_result_type = { PyObject_HEAD_INIT(NULL) 0 };
+PyTypeObject miss_result_type = { PyObject_HEAD_INIT(NULL) 0 };
+
+namespace
+{
+/*
+ * Per result type: slot_value() returns a new reference for the named field, or nullptr w/o an exception
+ * set if the type has no (value for the) field.  set_slot() returns 1 if the field lives in a slot, 0 if it
+ * does not and -1 w/ an exception set on failure.  field_names() lists what raw_result has to contain.
+ */
+
+PyObject*
+get_value(get_result_fields& fields)
+{
+    if (fields.pyObj_value == nullptr) {
+        if (fields.tape != nullptr && fields.tape->valid()) {
+            fields.pyObj_value = fields.tape->materialize();
+            if (fields.pyObj_value == nullptr) {
+                // e.g. invalid UTF-8, hand the raw bytes to the transcoder so it can raise the appropriate error
+                PyErr_Clear();
+            } else {
+                fields.value_decoded = true;
+            }
+        }
+        if (fields.pyObj_value == nullptr && fields.shared_value) {
+            fields.pyObj_value = PyBytes_FromStringAndSize(reinterpret_cast<const char*>(fields.shared_value->data()),
+                                                           static_cast<Py_ssize_t>(fields.shared_value->size()));
+            if (fields.pyObj_value == nullptr) {
+                return nullptr;
+            }
+        }
+        if (fields.pyObj_value == nullptr) {
+            try {
+                fields.pyObj_value = binary_to_PyObject(std::move(fields.value));
+            } catch (const std::exception& e) {
+                PyErr_SetString(PyExc_TypeError, e.what());
+                return nullptr;
+            }
+        }
+        fields.tape.reset();
+        fields.shared_value.reset();
+        couchbase::core::utils::binary{}.swap(fields.value);
+    }
+    Py_INCREF(fields.pyObj_value);
+    return fields.pyObj_value;
+}
+
+/*
+ * The raw value as a read-only memoryview.  If no Python value exists yet the document is moved into the view
+ * (and becomes the result's value), otherwise the view is taken over the existing value if it is a buffer.
+ */
+PyObject*
+get_value_view(get_result_fields& fields)
+{
+    // a shared (cached) document is not handed over, the view is taken over a bytes copy of it below
+    if (fields.pyObj_value == nullptr && !fields.shared_value && (fields.tape == nullptr || !fields.tape->valid())) {
+        fields.pyObj_value = binary_to_PyMemoryView(std::move(fields.value));
+        couchbase::core::utils::binary{}.swap(fields.value);
+        fields.tape.reset();
+        if (fields.pyObj_value == nullptr) {
+            return nullptr;
+        }
+        Py_INCREF(fields.pyObj_value);
+        return fields.pyObj_value;
+    }
+    PyObject* pyObj_value = get_value(fields);
+    if (pyObj_value == nullptr) {
+        return nullptr;
+    }
+    if (PyMemoryView_Check(pyObj_value)) {
+        return pyObj_value;
+    }
+    if (!PyObject_CheckBuffer(pyObj_value)) {
+        // e.g. decoded by the native JSON decoder, there is nothing to view
+        Py_DECREF(pyObj_value);
+        return nullptr;
+    }
+    PyObject* pyObj_view = PyMemoryView_FromObject(pyObj_value);
+    Py_DECREF(pyObj_value);
+    return pyObj_view;
+}
+
+PyObject*
+slot_value(get_result_fields& fields, const char* name)
+{
+    if (std::strcmp(name, RESULT_VALUE) == 0) {
+        return get_value(fields);
+    }
+    if (std::strcmp(name, RESULT_VALUE_VIEW) == 0) {
+        return get_value_view(fields);
+    }
+    if (std::strcmp(name, RESULT_CAS) == 0) {
+        return PyLong_FromUnsignedLongLong(fields.cas);
+    }
+    if (std::strcmp(name, RESULT_FLAGS) == 0) {
+        return PyLong_FromUnsignedLong(fields.flags);
+    }
+    if (std::strcmp(name, RESULT_KEY) == 0) {
+        return PyUnicode_FromStringAndSize(fields.key.data(), static_cast<Py_ssize_t>(fields.key.size()));
+    }
+    if (std::strcmp(name, RESULT_VALUE_DECODED) == 0) {
+        // only known once the value exists
+        PyObject* pyObj_value = get_value(fields);
+        if (pyObj_value == nullptr) {
+            return nullptr;
+        }
+        Py_DECREF(pyObj_value);
+        return PyBool_FromLong(static_cast<long>(fields.value_decoded));
+    }
+    if (std::strcmp(name, RESULT_EXPIRY) == 0 && fields.expiry.has_value()) {
+        return PyLong_FromUnsignedLong(fields.expiry.value());
+    }
+    if (std::strcmp(name, "is_replica") == 0 && fields.is_replica.has_value()) {
+        return PyBool_FromLong(static_cast<long>(fields.is_replica.value()));
+    }
+    return nullptr;
+}
+
+int
+set_slot(get_result_fields& fields, const char* name, PyObject* value)
+{
+    if (std::strcmp(name, RESULT_VALUE) != 0) {
+        return 0;
+    }
+    // e.g. the value decoded by the transcoder replaces the raw one
+    Py_INCREF(value);
+    Py_XSETREF(fields.pyObj_value, value);
+    fields.tape.reset();
+    fields.shared_value.reset();
+    couchbase::core::utils::binary{}.swap(fields.value);
+    return 1;
+}
+
+const char* const*
+field_names([[maybe_unused]] const get_result_fields& fields)
+{
+    static const char* const names[] = {
+        RESULT_CAS, RESULT_KEY, RESULT_FLAGS, RESULT_VALUE, RESULT_VALUE_DECODED, RESULT_EXPIRY, "is_replica", nullptr
+    };
+    return names;
+}
+
+void
+clear_slots(get_result_fields& fields)
+{
+    Py_CLEAR(fields.pyObj_value);
+}
+
+PyObject*
+slot_value(mutation_result_fields& fields, const char* name)
+{
+    if (std::strcmp(name, RESULT_CAS) == 0) {
+        return PyLong_FromUnsignedLongLong(fields.cas);
+    }
+    if (std::strcmp(name, RESULT_KEY) == 0) {
+        return PyUnicode_FromStringAndSize(fields.key.data(), static_cast<Py_ssize_t>(fields.key.size()));
+    }
+    if (std::strcmp(name, RESULT_MUTATION_TOKEN) == 0) {
+        if (fields.pyObj_token == nullptr) {
+            fields.pyObj_token = create_mutation_token_obj(fields.token);
+            if (fields.pyObj_token == nullptr) {
+                return nullptr;
+            }
+        }
+        Py_INCREF(fields.pyObj_token);
+        return fields.pyObj_token;
+    }
+    return nullptr;
+}
+
+int
+set_slot([[maybe_unused]] mutation_result_fields& fields, [[maybe_unused]] const char* name, [[maybe_unused]] PyObject* value)
+{
+    return 0;
+}
+
+const char* const*
+field_names([[maybe_unused]] const mutation_result_fields& fields)
+{
+    static const char* const names[] = { RESULT_CAS, RESULT_KEY, RESULT_MUTATION_TOKEN, nullptr };
+    return names;
+}
+
+void
+clear_slots(mutation_result_fields& fields)
+{
+    Py_CLEAR(fields.pyObj_token);
+}
+
+PyObject*
+slot_value(exists_result_fields& fields, const char* name)
+{
+    if (std::strcmp(name, RESULT_CAS) == 0) {
+        return PyLong_FromUnsignedLongLong(fields.cas);
+    }
+    if (std::strcmp(name, RESULT_KEY) == 0) {
+        return PyUnicode_FromStringAndSize(fields.key.data(), static_cast<Py_ssize_t>(fields.key.size()));
+    }
+    if (std::strcmp(name, RESULT_EXISTS) == 0) {
+        return PyBool_FromLong(static_cast<long>(fields.exists));
+    }
+    return nullptr;
+}
+
+int
+set_slot([[maybe_unused]] exists_result_fields& fields, [[maybe_unused]] const char* name, [[maybe_unused]] PyObject* value)
+{
+    return 0;
+}
+
+const char* const*
+field_names([[maybe_unused]] const exists_result_fields& fields)
+{
+    static const char* const names[] = { RESULT_CAS, RESULT_KEY, RESULT_EXISTS, nullptr };
+    return names;
+}
+
+void
+clear_slots([[maybe_unused]] exists_result_fields& fields)
+{
+}
+
+// returns a new reference, or nullptr (w/ an exception set on failure)
+template<typename Fields>
+PyObject*
+typed_result_lookup(typed_result<Fields>* self, const char* name)
+{
+    if (self->dict != nullptr) {
+        PyObject* val = PyDict_GetItemString(self->dict, name);
+        if (val != nullptr) {
+            Py_INCREF(val);
+            return val;
+        }
+        if (self->materialized) {
+            return nullptr;
+        }
+    }
+    return slot_value(self->fields, name);
+}
+
+template<typename Fields>
+int
+typed_result_materialize(typed_result<Fields>* self)
+{
+    if (self->materialized) {
+        return 0;
+    }
+    if (self->dict == nullptr && (self->dict = PyDict_New()) == nullptr) {
+        return -1;
+    }
+    for (auto* name = field_names(self->fields); *name != nullptr; name++) {
+        if (PyDict_GetItemString(self->dict, *name) != nullptr) {
+            // set from Python, takes precedence
+            continue;
+        }
+        PyObject* pyObj_tmp = slot_value(self->fields, *name);
+        if (pyObj_tmp == nullptr) {
+            if (PyErr_Occurred() != nullptr) {
+                return -1;
+            }
+            continue;
+        }
+        if (-1 == PyDict_SetItemString(self->dict, *name, pyObj_tmp)) {
+            Py_DECREF(pyObj_tmp);
+            return -1;
+        }
+        Py_DECREF(pyObj_tmp);
+    }
+    self->materialized = true;
+    return 0;
+}
+
+template<typename Fields>
+PyObject*
+typed_result__get__(typed_result<Fields>* self, PyObject* args)
+{
+    const char* field_name = nullptr;
+    PyObject* default_value = nullptr;
+
+    if (!PyArg_ParseTuple(args, "s|O", &field_name, &default_value)) {
+        return nullptr;
+    }
+    PyObject* val = typed_result_lookup(self, field_name);
+    if (val != nullptr || PyErr_Occurred() != nullptr) {
+        return val;
+    }
+    if (default_value == nullptr) {
+        Py_RETURN_NONE;
+    }
+    // borrowed from args
+    Py_INCREF(default_value);
+    return default_value;
+}
+
+template<typename Fields>
+PyObject*
+typed_result__set__(typed_result<Fields>* self, PyObject* args)
+{
+    const char* field_name = nullptr;
+    PyObject* value = nullptr;
+
+    if (!PyArg_ParseTuple(args, "sO", &field_name, &value)) {
+        return nullptr;
+    }
+    if (!self->materialized) {
+        auto rc = set_slot(self->fields, field_name, value);
+        if (rc == -1) {
+            return nullptr;
+        }
+        if (rc == 1) {
+            Py_RETURN_NONE;
+        }
+    }
+    if (self->dict == nullptr && (self->dict = PyDict_New()) == nullptr) {
+        return nullptr;
+    }
+    if (-1 == PyDict_SetItemString(self->dict, field_name, value)) {
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+template<typename Fields>
+PyObject*
+typed_result__field__(typed_result<Fields>* self, void* closure)
+{
+    PyObject* val = typed_result_lookup(self, static_cast<const char*>(closure));
+    if (val == nullptr && PyErr_Occurred() == nullptr) {
+        Py_RETURN_NONE;
+    }
+    return val;
+}
+
+template<typename Fields>
+PyObject*
+typed_result__raw_result__(typed_result<Fields>* self, [[maybe_unused]] void* closure)
+{
+    if (-1 == typed_result_materialize(self)) {
+        return nullptr;
+    }
+    Py_INCREF(self->dict);
+    return self->dict;
+}
+
+template<typename Fields>
+PyObject*
+typed_result__strerror__(typed_result<Fields>* self, [[maybe_unused]] PyObject* args)
+{
+    if (self->fields.ec) {
+        return PyUnicode_FromString(self->fields.ec.message().c_str());
+    }
+    Py_RETURN_NONE;
+}
+
+template<typename Fields>
+PyObject*
+typed_result__err__(typed_result<Fields>* self, [[maybe_unused]] PyObject* args)
+{
+    if (self->fields.ec) {
+        return PyLong_FromLong(self->fields.ec.value());
+    }
+    Py_RETURN_NONE;
+}
+
+template<typename Fields>
+PyObject*
+typed_result__category__(typed_result<Fields>* self, [[maybe_unused]] PyObject* args)
+{
+    if (self->fields.ec) {
+        return PyUnicode_FromString(self->fields.ec.category().name());
+    }
+    Py_RETURN_NONE;
+}
+
+template<typename Fields>
+PyObject*
+typed_result__str__(typed_result<Fields>* self)
+{
+    const char* format_string = "%s:{err=%i, err_string=%s, value=%S}";
+    if (-1 == typed_result_materialize(self)) {
+        return nullptr;
+    }
+    const char* type_name = std::strrchr(Py_TYPE(self)->tp_name, '.');
+    type_name = type_name == nullptr ? Py_TYPE(self)->tp_name : type_name + 1;
+    return PyUnicode_FromFormat(format_string, type_name, self->fields.ec.value(), self->fields.ec.message().c_str(), self->dict);
+}
+
+template<typename Fields>
+void
+typed_result_dealloc(typed_result<Fields>* self)
+{
+    Py_XDECREF(self->dict);
+    clear_slots(self->fields);
+    self->fields.~Fields();
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+template<typename Fields>
+PyObject*
+typed_result_new(PyTypeObject* type, PyObject*, PyObject*)
+{
+    auto* self = reinterpret_cast<typed_result<Fields>*>(type->tp_alloc(type, 0));
+    if (self == nullptr) {
+        return nullptr;
+    }
+    new (&self->fields) Fields{};
+    self->dict = nullptr;
+    self->materialized = false;
+    return reinterpret_cast<PyObject*>(self);
+}
+
+template<typename Fields>
+PyMethodDef typed_result_methods[] = {
+    { "strerror", (PyCFunction)typed_result__strerror__<Fields>, METH_NOARGS, PyDoc_STR("String description of error") },
+    { "err", (PyCFunction)typed_result__err__<Fields>, METH_NOARGS, PyDoc_STR("Integer error code") },
+    { "err_category", (PyCFunction)typed_result__category__<Fields>, METH_NOARGS, PyDoc_STR("error category, expressed as a string") },
+    { "get", (PyCFunction)typed_result__get__<Fields>, METH_VARARGS, PyDoc_STR("get field in result object") },
+    { "set", (PyCFunction)typed_result__set__<Fields>, METH_VARARGS, PyDoc_STR("set field in result object") },
+    { NULL, NULL, 0, NULL }
+};
+
+template<typename Fields>
+PyGetSetDef
+raw_result_getset()
+{
+    return { "raw_result", (getter)typed_result__raw_result__<Fields>, nullptr, PyDoc_STR("Object for the raw result data.\n"), nullptr };
+}
+
+// the field name doubles as the getter's closure
+template<typename Fields>
+PyGetSetDef
+field_getset(const char* name, const char* doc)
+{
+    return { name, (getter)typed_result__field__<Fields>, nullptr, doc, const_cast<char*>(name) };
+}
+
+PyGetSetDef get_result_getset[] = {
+    raw_result_getset<get_result_fields>(),
+    field_getset<get_result_fields>(RESULT_CAS, PyDoc_STR("CAS of the document")),
+    field_getset<get_result_fields>(RESULT_KEY, PyDoc_STR("Key of the document")),
+    field_getset<get_result_fields>(RESULT_FLAGS, PyDoc_STR("Flags of the document")),
+    field_getset<get_result_fields>(RESULT_VALUE, PyDoc_STR("Value of the document")),
+    field_getset<get_result_fields>(RESULT_EXPIRY, PyDoc_STR("Expiry of the document, if it was requested")),
+    field_getset<get_result_fields>("is_replica", PyDoc_STR("Whether the document was read from a replica")),
+    { NULL },
+};
+
+PyGetSetDef mutation_result_getset[] = {
+    raw_result_getset<mutation_result_fields>(),
+    field_getset<mutation_result_fields>(RESULT_CAS, PyDoc_STR("CAS of the document")),
+    field_getset<mutation_result_fields>(RESULT_KEY, PyDoc_STR("Key of the document")),
+    field_getset<mutation_result_fields>(RESULT_MUTATION_TOKEN, PyDoc_STR("Mutation token of the mutation")),
+    { NULL },
+};
+
+PyGetSetDef exists_result_getset[] = {
+    raw_result_getset<exists_result_fields>(),
+    field_getset<exists_result_fields>(RESULT_CAS, PyDoc_STR("CAS of the document")),
+    field_getset<exists_result_fields>(RESULT_KEY, PyDoc_STR("Key of the document")),
+    field_getset<exists_result_fields>(RESULT_EXISTS, PyDoc_STR("Whether the document exists")),
+    { NULL },
+};
+
+template<typename Fields>
+int
+typed_result_type_init(PyTypeObject* p, PyObject** ptr, const char* name, const char* doc, PyGetSetDef* getset)
+{
+    *ptr = (PyObject*)p;
+    if (p->tp_name) {
+        return 0;
+    }
+
+    p->tp_name = name;
+    p->tp_doc = doc;
+    p->tp_basicsize = sizeof(typed_result<Fields>);
+    p->tp_flags = Py_TPFLAGS_DEFAULT;
+    p->tp_new = typed_result_new<Fields>;
+    p->tp_dealloc = (destructor)typed_result_dealloc<Fields>;
+    p->tp_methods = typed_result_methods<Fields>;
+    p->tp_getset = getset;
+    p->tp_repr = (reprfunc)typed_result__str__<Fields>;
+
+    return PyType_Ready(p);
+}
+
+template<typename Fields>
+PyObject*
+create_typed_result_obj(PyTypeObject* type, Fields&& fields)
+{
+    PyObject* pyObj_result = typed_result_new<Fields>(type, nullptr, nullptr);
+    if (pyObj_result == nullptr) {
+        return nullptr;
+    }
+    reinterpret_cast<typed_result<Fields>*>(pyObj_result)->fields = std::move(fields);
+    return pyObj_result;
+}
+} // namespace
+
+int
+pycbc_get_result_type_init(PyObject** ptr)
+{
+    return typed_result_type_init<get_result_fields>(
+      &get_result_type, ptr, "pycbc_core.get_result", "Result of a KV read operation", get_result_getset);
+}
+
+int
+pycbc_mutation_result_type_init(PyObject** ptr)
+{
+    return typed_result_type_init<mutation_result_fields>(
+      &mutation_result_type, ptr, "pycbc_core.mutation_result", "Result of a KV mutation operation", mutation_result_getset);
+}
+
+int
+pycbc_exists_result_type_init(PyObject** ptr)
+{
+    return typed_result_type_init<exists_result_fields>(
+      &exists_result_type, ptr, "pycbc_core.exists_result", "Result of a KV exists operation", exists_result_getset);
+}
+
+PyObject*
+create_get_result_obj(get_result_fields fields)
+{
+    return create_typed_result_obj(&get_result_type, std::move(fields));
+}
+
+PyObject*
+create_mutation_result_obj(mutation_result_fields fields)
+{
+    return create_typed_result_obj(&mutation_result_type, std::move(fields));
+}
+
+PyObject*
+create_exists_result_obj(exists_result_fields fields)
+{
+    return create_typed_result_obj(&exists_result_type, std::move(fields));
+}
+
+static PyObject*
+miss_result__strerror__(miss_result* self, [[maybe_unused]] PyObject* args)
+{
+    return PyUnicode_FromString(self->ec.message().c_str());
+}
+
+static PyObject*
+miss_result__err__(miss_result* self, [[maybe_unused]] PyObject* args)
+{
+    return PyLong_FromLong(self->ec.value());
+}
+
+static PyObject*
+miss_result__category__(miss_result* self, [[maybe_unused]] PyObject* args)
+{
+    return PyUnicode_FromString(self->ec.category().name());
+}
+
+static PyObject*
+miss_result__str__(miss_result* self)
+{
+    return PyUnicode_FromFormat("miss_result:{err=%i, err_string=%s}", self->ec.value(), self->ec.message().c_str());
+}
+
+static PyMethodDef miss_result_methods[] = {
+    { "strerror", (PyCFunction)miss_result__strerror__, METH_NOARGS, PyDoc_STR("String description of error") },
+    { "err", (PyCFunction)miss_result__err__, METH_NOARGS, PyDoc_STR("Integer error code") },
+    { "err_category", (PyCFunction)miss_result__category__, METH_NOARGS, PyDoc_STR("error category, expressed as a string") },
+    { NULL, NULL, 0, NULL }
+};
+
+int
+pycbc_miss_result_type_init(PyObject** ptr)
+{
+    PyTypeObject* p = &miss_result_type;
+
+    *ptr = (PyObject*)p;
+    if (p->tp_name) {
+        return 0;
+    }
+
+    p->tp_name = "pycbc_core.miss_result";
+    p->tp_doc = "Result of a KV read that did not find what it was looking for (see miss_errors)";
+    p->tp_basicsize = sizeof(miss_result);
+    p->tp_flags = Py_TPFLAGS_DEFAULT;
+    p->tp_new = PyType_GenericNew;
+    p->tp_methods = miss_result_methods;
+    p->tp_repr = (reprfunc)miss_result__str__;
+
+    return PyType_Ready(p);
+}
+
+PyObject*
+create_miss_result_obj(std::error_code ec)
+{
+    auto* self = reinterpret_cast<miss_result*>(miss_result_type.tp_alloc(&miss_result_type, 0));
+    if (self == nullptr) {
+        return nullptr;
+    }
+    self->ec = ec;
+    return reinterpret_cast<PyObject*>(self);
+}
@@ -0,0 +1,121 @@
+/*
+ *   Copyright 2016-2022. Couchbase, Inc.
+ *   All Rights Reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#pragma once
+
+#include "client.hxx"
+#include "json_transcoder.hxx"
+#include <core/utils/binary.hxx>
+#include <couchbase/mutation_token.hxx>
+#include <memory>
+#include <optional>
+#include <string>
+#include <system_error>
+
+/**
+ * Fixed-layout results for the KV hot path (get_result, mutation_result, exists_result).
+ *
+ * Unlike pycbc_core.result there is no dict per result: the fields are kept in C slots and a Python object is
+ * only created when a field is read (through the getsets or get()).  get(), set(), raw_result, err(),
+ * strerror() and err_category() behave like they do for pycbc_core.result, so the Python wrappers can be
+ * handed either.  A dict is only created for fields set from Python that have no slot, and once raw_result
+ * is used (from then on the dict holds every field).
+ */
+template<typename Fields>
+struct typed_result {
+    PyObject_HEAD Fields fields;
+    PyObject* dict;
+    // raw_result has been requested, the dict is the source of truth
+    bool materialized;
+};
+
+struct get_result_fields {
+    std::error_code ec{};
+    std::uint64_t cas{ 0 };
+    std::uint32_t flags{ 0 };
+    std::string key{};
+    std::optional<std::uint32_t> expiry{};
+    std::optional<bool> is_replica{};
+    // raw document, released once the Python value has been created
+    couchbase::core::utils::binary value{};
+    // set instead of value for a document served from a read cache, which keeps owning it
+    std::shared_ptr<const couchbase::core::utils::binary> shared_value{};
+    // set when the document was already parsed on the IO thread
+    std::shared_ptr<const json_tape> tape{};
+    PyObject* pyObj_value{ nullptr };
+    bool value_decoded{ false };
+};
+
+struct mutation_result_fields {
+    std::error_code ec{};
+    std::uint64_t cas{ 0 };
+    std::string key{};
+    couchbase::mutation_token token{};
+    PyObject* pyObj_token{ nullptr };
+};
+
+struct exists_result_fields {
+    std::error_code ec{};
+    std::uint64_t cas{ 0 };
+    std::string key{};
+    bool exists{ false };
+};
+
+using get_result = typed_result<get_result_fields>;
+using mutation_result = typed_result<mutation_result_fields>;
+using exists_result = typed_result<exists_result_fields>;
+
+int
+pycbc_get_result_type_init(PyObject** ptr);
+
+int
+pycbc_mutation_result_type_init(PyObject** ptr);
+
+int
+pycbc_exists_result_type_init(PyObject** ptr);
+
+// the create_*_obj() functions return a new reference, or nullptr w/ a Python exception set
+PyObject*
+create_get_result_obj(get_result_fields fields);
+
+PyObject*
+create_mutation_result_obj(mutation_result_fields fields);
+
+PyObject*
+create_exists_result_obj(exists_result_fields fields);
+
+extern PyTypeObject get_result_type;
+extern PyTypeObject mutation_result_type;
+extern PyTypeObject exists_result_type;
+
+/**
+ * Handed back instead of an exception when a read fails w/ one of the errors listed in
+ * read_options::miss_errors (e.g. document_not_found).  Only carries the error code, there is no error
+ * context to build and nothing for the Python side to raise and catch.
+ */
+struct miss_result {
+    PyObject_HEAD std::error_code ec;
+};
+
+int
+pycbc_miss_result_type_init(PyObject** ptr);
+
+// returns a new reference, or nullptr w/ a Python exception set
+PyObject*
+create_miss_result_obj(std::error_code ec);
+
+extern PyTypeObject miss_result_type;
@@ -673,9 +673,10 @@ do_bucket_mgmt_op(connection& conn,
                   std::shared_ptr<std::promise<PyObject*>> barrier)
 {
     using response_type = typename Request::response_type;
-    Py_BEGIN_ALLOW_THREADS conn.cluster_->execute(req, [pyObj_callback, pyObj_errback, barrier](response_type resp) {
-        create_result_from_bucket_mgmt_op_response(resp, pyObj_callback, pyObj_errback, barrier);
-    });
+    Py_BEGIN_ALLOW_THREADS conn.cluster_->execute(
+      req, conn.defer<response_type>([pyObj_callback, pyObj_errback, barrier](response_type resp) {
+          create_result_from_bucket_mgmt_op_response(resp, pyObj_callback, pyObj_errback, barrier);
+      }));
     Py_END_ALLOW_THREADS Py_RETURN_NONE;
 }
 
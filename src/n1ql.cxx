@@ -21,6 +21,15 @@
 #include "utils.hxx"
 #include <couchbase/query_scan_consistency.hxx>
 #include <couchbase/query_profile.hxx>
+#include <couchbase/error_codes.hxx>
+#include <core/utils/json.hxx>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
 
 std::string
 scan_consistency_type_to_string(couchbase::query_scan_consistency consistency)
@@ -301,8 +310,9 @@ create_query_result(couchbase::core::operations::query_response resp,
     } else {
         for (auto const& row : resp.rows) {
             PyObject* pyObj_row = PyBytes_FromStringAndSize(row.c_str(), row.length());
-            rows->put(pyObj_row);
+            rows->stage(pyObj_row);
         }
+        rows->publish();
 
         auto res = create_result_from_query_response(resp, include_metrics);
         if (res == nullptr || PyErr_Occurred() != nullptr) {
@@ -342,6 +352,235 @@ create_query_result(couchbase::core::operations::query_response resp,
     PyGILState_Release(state);
 }
 
+namespace
+{
+/**
+ * A query w/ adhoc=false run through the connection's prepared statement cache: the statement is prepared once
+ * (PREPARE) and after that run by name (EXECUTE), so only its first run pays for the prepare round trip.  If the
+ * query service does not know the cached name anymore, the statement is prepared once more.  All requests sent for
+ * the query share the caller's timeout, each one only gets what is left of it.
+ */
+struct prepared_query {
+    connection* conn;
+    couchbase::core::operations::query_request req;
+    std::string key;
+    std::shared_ptr<rows_queue<PyObject*>> rows;
+    PyObject* pyObj_callback;
+    PyObject* pyObj_errback;
+    std::chrono::steady_clock::time_point deadline;
+    bool reprepared{ false };
+};
+
+using prepare_join_state = prepare_single_flight<couchbase::core::operations::query_response>::join_state;
+
+// query service errors for a prepared statement it does not know (anymore)
+bool
+is_stale_prepared(const couchbase::core::operations::query_response& resp)
+{
+    auto code = resp.ctx.first_error_code;
+    return code == 4040 || code == 4050 || code == 4070;
+}
+
+couchbase::core::operations::query_request
+build_prepare_request(const std::string& statement,
+                      const std::optional<std::string>& query_context,
+                      std::optional<std::chrono::milliseconds> timeout)
+{
+    couchbase::core::operations::query_request prep{};
+    prep.statement = "PREPARE " + statement;
+    prep.adhoc = true;
+    prep.query_context = query_context;
+    prep.timeout = timeout.value_or(couchbase::core::timeout_defaults::query_timeout);
+    return prep;
+}
+
+// what is left of the query's timeout for its next request, nothing once it ran out
+std::optional<std::chrono::milliseconds>
+remaining_timeout(const prepared_query& query)
+{
+    auto left = std::chrono::duration_cast<std::chrono::milliseconds>(query.deadline - std::chrono::steady_clock::now());
+    if (left.count() <= 0) {
+        return {};
+    }
+    return left;
+}
+
+std::optional<std::string>
+prepared_name(const couchbase::core::operations::query_response& resp)
+{
+    if (resp.ctx.ec || resp.rows.empty()) {
+        return {};
+    }
+    try {
+        auto row = couchbase::core::utils::json::parse(resp.rows.front());
+        if (const auto* name = row.find("name"); name != nullptr && name->is_string()) {
+            return name->get_string();
+        }
+    } catch (const std::exception&) {
+        // not a PREPARE result we understand, handled as if there was no name
+    }
+    return {};
+}
+
+void
+prepare_and_execute_query(std::shared_ptr<prepared_query> query);
+
+void
+complete_prepared_query(const std::shared_ptr<prepared_query>& query, couchbase::core::operations::query_response resp)
+{
+    create_query_result(std::move(resp), query->req.metrics, query->rows, query->pyObj_callback, query->pyObj_errback);
+}
+
+// the timeout ran out before the statement itself was sent
+void
+complete_timed_out_query(const std::shared_ptr<prepared_query>& query)
+{
+    couchbase::core::operations::query_response resp{};
+    resp.ctx.ec = couchbase::errc::common::unambiguous_timeout;
+    resp.ctx.statement = query->req.statement;
+    complete_prepared_query(query, std::move(resp));
+}
+
+void
+execute_prepared_query(std::shared_ptr<prepared_query> query, std::string name)
+{
+    auto timeout = remaining_timeout(*query);
+    if (!timeout) {
+        complete_timed_out_query(query);
+        return;
+    }
+    auto req = query->req;
+    req.timeout = timeout;
+    req.adhoc = true;
+    req.statement = "EXECUTE `" + name + "`";
+    auto* conn = query->conn;
+    conn->stream_cluster()->execute(
+      std::move(req),
+      conn->defer<couchbase::core::operations::query_response>(
+        [query, name = std::move(name)](couchbase::core::operations::query_response resp) {
+            if (is_stale_prepared(resp) && !query->reprepared) {
+                query->reprepared = true;
+                query->conn->prepared_cache_->invalidate(query->key, name);
+                prepare_and_execute_query(query);
+                return;
+            }
+            complete_prepared_query(query, std::move(resp));
+        }));
+}
+
+// runs the query once the PREPARE of its statement (sent by it or by another query) answered, on the dispatcher
+void
+execute_after_prepare(const std::shared_ptr<prepared_query>& query, const couchbase::core::operations::query_response& resp)
+{
+    if (resp.ctx.ec) {
+        complete_prepared_query(query, resp);
+        return;
+    }
+    auto name = prepared_name(resp);
+    if (!name) {
+        // nothing to run the statement by, leave the prepare handling to the core
+        auto timeout = remaining_timeout(*query);
+        if (!timeout) {
+            complete_timed_out_query(query);
+            return;
+        }
+        auto req = query->req;
+        req.timeout = timeout;
+        query->conn->stream_cluster()->execute(std::move(req),
+                                               query->conn->defer<couchbase::core::operations::query_response>(
+                                                 [query](couchbase::core::operations::query_response query_resp) {
+                                                     complete_prepared_query(query, std::move(query_resp));
+                                                 }));
+        return;
+    }
+    execute_prepared_query(query, std::move(*name));
+}
+
+// the name is cached before the queries that waited for the PREPARE are run, so later misses find it
+void
+complete_prepare(connection* conn, const std::string& key, const couchbase::core::operations::query_response& resp)
+{
+    if (auto name = prepared_name(resp); name) {
+        conn->prepared_cache_->put(key, std::move(*name));
+    }
+    conn->prepares_in_flight_.complete(key, resp);
+}
+
+void
+prepare_and_execute_query(std::shared_ptr<prepared_query> query)
+{
+    // checked before joining, a PREPARE that is never sent would leave the queries waiting for it w/o an answer
+    auto timeout = remaining_timeout(*query);
+    if (!timeout) {
+        complete_timed_out_query(query);
+        return;
+    }
+    auto* conn = query->conn;
+    auto state = conn->prepares_in_flight_.join(
+      query->key,
+      [query](const couchbase::core::operations::query_response& resp) { execute_after_prepare(query, resp); },
+      [conn, &key = query->key]() { return conn->prepared_cache_->contains(key); });
+    if (state == prepare_join_state::joined) {
+        return;
+    }
+    if (state == prepare_join_state::prepared) {
+        if (auto name = conn->prepared_cache_->lookup(query->key); name) {
+            execute_prepared_query(std::move(query), std::move(*name));
+            return;
+        }
+        // evicted again already
+        prepare_and_execute_query(std::move(query));
+        return;
+    }
+    conn->cluster_->execute(
+      build_prepare_request(query->req.statement, query->req.query_context, timeout),
+      conn->defer<couchbase::core::operations::query_response>([query](couchbase::core::operations::query_response resp) {
+          complete_prepare(query->conn, query->key, resp);
+          execute_after_prepare(query, resp);
+      }));
+}
+
+// all PREPAREs are sent at once (or joined, if one is in flight already), the handlers only touch their own slot
+struct prepare_batch {
+    std::mutex mutex;
+    std::vector<std::optional<couchbase::core::error_context::query>> errors;
+    std::size_t pending;
+    std::promise<void> done;
+};
+
+void
+submit_prepares(connection* conn,
+                const std::vector<std::string>& statements,
+                const std::optional<std::string>& query_context,
+                std::optional<std::chrono::milliseconds> timeout,
+                std::shared_ptr<prepare_batch> batch)
+{
+    for (std::size_t i = 0; i < statements.size(); i++) {
+        auto key = prepared_statement_cache::key(query_context, statements[i]);
+        auto on_prepared = [batch, i](const couchbase::core::operations::query_response& resp) {
+            std::lock_guard<std::mutex> lock(batch->mutex);
+            if (!prepared_name(resp)) {
+                batch->errors[i] = resp.ctx;
+            }
+            if (--batch->pending == 0) {
+                batch->done.set_value();
+            }
+        };
+        // the warm-up prepares the statement even if it is cached already
+        if (conn->prepares_in_flight_.join(key, on_prepared, []() { return false; }) == prepare_join_state::joined) {
+            continue;
+        }
+        // deferred, as queries that joined this PREPARE are run from the handler
+        conn->cluster_->execute(build_prepare_request(statements[i], query_context, timeout),
+                                conn->defer<couchbase::core::operations::query_response>(
+                                  [conn, key = std::move(key), on_prepared](couchbase::core::operations::query_response resp) {
+                                      complete_prepare(conn, key, resp);
+                                      on_prepared(resp);
+                                  }));
+    }
+}
+} // namespace
+
 streamed_result*
 handle_n1ql_query([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kwargs)
 {
@@ -392,23 +631,141 @@ handle_n1ql_query([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kwa
     // timeout is always set either to default, or timeout provided in options
     streamed_result* streamed_res = create_streamed_result_obj(req.timeout.value());
 
-    // TODO:  let the couchbase++ streaming stabilize a bit more...
-    // req.row_callback = [rows = streamed_res->rows](std::string&& row) {
-    //     PyGILState_STATE state = PyGILState_Ensure();
-    //     PyObject* pyObj_row = PyBytes_FromStringAndSize(row.c_str(), row.length());
-    //     rows->put(pyObj_row);
-    //     PyGILState_Release(state);
-    //     return couchbase::core::utils::json::stream_control::next_row;
-    // };
+    // rows are handed to the iterator while the body is still arriving, the response only carries the metadata.
+    // Both go through the dispatcher, which runs them in order, so the end of the stream is never put ahead of
+    // the last rows.
+    auto stream = std::make_shared<row_stream>(conn, streamed_res->rows, conn->stream_high_water_rows_, conn->stream_high_water_bytes_);
+    streamed_res->stream = stream;
+    req.row_callback = [stream](std::string&& row) {
+        return stream->on_row(std::move(row)) ? couchbase::core::utils::json::stream_control::next_row
+                                              : couchbase::core::utils::json::stream_control::stop;
+    };
+
+    if (!req.adhoc && conn->prepared_cache_) {
+        auto key = prepared_statement_cache::key(req.query_context, req.statement);
+        auto name = conn->prepared_cache_->lookup(key);
+        auto deadline = std::chrono::steady_clock::now() + req.timeout.value();
+        auto query = std::make_shared<prepared_query>(
+          prepared_query{ conn, std::move(req), std::move(key), streamed_res->rows, pyObj_callback, pyObj_errback, deadline });
+        Py_BEGIN_ALLOW_THREADS if (name)
+        {
+            execute_prepared_query(std::move(query), std::move(*name));
+        }
+        else
+        {
+            prepare_and_execute_query(std::move(query));
+        }
+        Py_END_ALLOW_THREADS
+        return streamed_res;
+    }
 
     {
-        Py_BEGIN_ALLOW_THREADS conn->cluster_->execute(
+        Py_BEGIN_ALLOW_THREADS conn->stream_cluster()->execute(
           req,
-          [rows = streamed_res->rows, include_metrics = req.metrics, pyObj_callback, pyObj_errback](
-            couchbase::core::operations::query_response resp) {
-              create_query_result(resp, include_metrics, rows, pyObj_callback, pyObj_errback);
-          });
+          conn->defer<couchbase::core::operations::query_response>(
+            [rows = streamed_res->rows, include_metrics = req.metrics, pyObj_callback, pyObj_errback](
+              couchbase::core::operations::query_response resp) {
+                create_query_result(std::move(resp), include_metrics, rows, pyObj_callback, pyObj_errback);
+            }));
         Py_END_ALLOW_THREADS
     }
     return streamed_res;
 }
+
+PyObject*
+handle_prepare_statements([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kwargs)
+{
+    PyObject* pyObj_conn = nullptr;
+    PyObject* pyObj_statements = nullptr;
+    char* query_context = nullptr;
+    unsigned long long timeout = 0;
+
+    static const char* kw_list[] = { "conn", "statements", "query_context", "timeout", nullptr };
+
+    const char* kw_format = "O!O|zK";
+    int ret = PyArg_ParseTupleAndKeywords(args,
+                                          kwargs,
+                                          kw_format,
+                                          const_cast<char**>(kw_list),
+                                          &PyCapsule_Type,
+                                          &pyObj_conn,
+                                          &pyObj_statements,
+                                          &query_context,
+                                          &timeout);
+    if (!ret) {
+        std::string msg = "Cannot prepare statements. Unable to parse args/kwargs.";
+        pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, msg.c_str());
+        return nullptr;
+    }
+
+    connection* conn = reinterpret_cast<connection*>(PyCapsule_GetPointer(pyObj_conn, "conn_"));
+    if (nullptr == conn) {
+        pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, NULL_CONN_OBJECT);
+        return nullptr;
+    }
+    if (!conn->prepared_cache_) {
+        pycbc_set_python_exception(
+          PycbcError::InvalidArgument, __FILE__, __LINE__, "Cannot prepare statements. The prepared statement cache is not enabled.");
+        return nullptr;
+    }
+
+    std::optional<std::string> context{};
+    if (query_context != nullptr) {
+        context = std::string(query_context);
+    }
+    std::optional<std::chrono::milliseconds> timeout_ms{};
+    if (timeout > 0) {
+        // comes in as microseconds
+        timeout_ms = std::chrono::milliseconds(timeout / 1000ULL);
+    }
+
+    PyObject* pyObj_seq = PySequence_Fast(pyObj_statements, "statements must be a sequence of strings.");
+    if (pyObj_seq == nullptr) {
+        return nullptr;
+    }
+    std::vector<std::string> statements{};
+    for (Py_ssize_t i = 0; i < PySequence_Fast_GET_SIZE(pyObj_seq); i++) {
+        PyObject* pyObj_statement = PySequence_Fast_GET_ITEM(pyObj_seq, i);
+        if (!PyUnicode_Check(pyObj_statement)) {
+            Py_DECREF(pyObj_seq);
+            pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Query statement is not a string.");
+            return nullptr;
+        }
+        statements.emplace_back(PyUnicode_AsUTF8(pyObj_statement));
+    }
+    Py_DECREF(pyObj_seq);
+
+    auto batch = std::make_shared<prepare_batch>();
+    batch->errors.resize(statements.size());
+    batch->pending = statements.size();
+    auto fut = batch->done.get_future();
+    if (statements.empty()) {
+        batch->done.set_value();
+    }
+    {
+        Py_BEGIN_ALLOW_THREADS submit_prepares(conn, statements, context, timeout_ms, batch);
+        fut.wait();
+        Py_END_ALLOW_THREADS
+    }
+
+    // statements that could not be prepared, w/ the reason
+    PyObject* pyObj_failed = PyDict_New();
+    for (std::size_t i = 0; i < statements.size(); i++) {
+        if (!batch->errors[i]) {
+            continue;
+        }
+        PyObject* pyObj_exc = nullptr;
+        if (batch->errors[i]->ec) {
+            pyObj_exc = build_exception_from_context(*batch->errors[i], __FILE__, __LINE__, "Error preparing N1QL statement.");
+        } else {
+            pyObj_exc = pycbc_build_exception(PycbcError::UnableToBuildResult, __FILE__, __LINE__, "PREPARE did not return a name.");
+        }
+        PyErr_Clear();
+        if (-1 == PyDict_SetItemString(pyObj_failed, statements[i].c_str(), pyObj_exc)) {
+            PyErr_Print();
+            PyErr_Clear();
+        }
+        Py_XDECREF(pyObj_exc);
+    }
+    return pyObj_failed;
+}
@@ -23,6 +23,9 @@
 streamed_result*
 handle_n1ql_query(PyObject* self, PyObject* args, PyObject* kwargs);
 
+PyObject*
+handle_prepare_statements(PyObject* self, PyObject* args, PyObject* kwargs);
+
 template<typename scan_consistency_type>
 scan_consistency_type
 str_to_scan_consistency_type(std::string consistency)
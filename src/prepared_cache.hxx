@@ -0,0 +1,225 @@
+/*
+ *   Copyright 2016-2022. Couchbase, Inc.
+ *   All Rights Reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Count bounded LRU of prepared statement names, keyed by query context and statement text.
+ *
+ * Looked up when a query w/ adhoc=false is issued and filled from the PREPARE responses (on the dispatcher),
+ * a single lock is enough as every access is one hash lookup.  An entry the query service no longer knows
+ * (e.g. after a query node restart) is dropped by invalidate() and prepared again.
+ */
+class prepared_statement_cache
+{
+  public:
+    explicit prepared_statement_cache(std::size_t capacity)
+      : capacity_{ capacity }
+    {
+    }
+
+    prepared_statement_cache(const prepared_statement_cache&) = delete;
+    prepared_statement_cache& operator=(const prepared_statement_cache&) = delete;
+
+    static std::string key(const std::optional<std::string>& query_context, const std::string& statement)
+    {
+        return query_context.value_or("") + '\n' + statement;
+    }
+
+    std::optional<std::string> lookup(const std::string& key)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            misses_++;
+            return {};
+        }
+        lru_.splice(lru_.begin(), lru_, it->second);
+        hits_++;
+        return it->second->second;
+    }
+
+    // no counters or LRU update, for checks that are not a query's lookup
+    bool contains(const std::string& key)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return index_.count(key) > 0;
+    }
+
+    void put(const std::string& key, std::string name)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            it->second->second = std::move(name);
+            lru_.splice(lru_.begin(), lru_, it->second);
+            return;
+        }
+        lru_.emplace_front(key, std::move(name));
+        index_.emplace(key, lru_.begin());
+        while (index_.size() > capacity_) {
+            index_.erase(lru_.back().first);
+            lru_.pop_back();
+            evictions_++;
+        }
+    }
+
+    // the query service rejected name, drop it unless a concurrent query has prepared the statement again already
+    void invalidate(const std::string& key, const std::string& name)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        reprepares_++;
+        auto it = index_.find(key);
+        if (it != index_.end() && it->second->second == name) {
+            lru_.erase(it->second);
+            index_.erase(it);
+        }
+    }
+
+    std::size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    std::size_t size()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return index_.size();
+    }
+
+    std::uint64_t hits() const
+    {
+        return hits_.load();
+    }
+
+    std::uint64_t misses() const
+    {
+        return misses_.load();
+    }
+
+    std::uint64_t reprepares() const
+    {
+        return reprepares_.load();
+    }
+
+    std::uint64_t evictions() const
+    {
+        return evictions_.load();
+    }
+
+  private:
+    using lru_list = std::list<std::pair<std::string, std::string>>;
+
+    const std::size_t capacity_;
+    std::mutex mutex_{};
+    lru_list lru_{};
+    std::unordered_map<std::string, lru_list::iterator> index_{};
+    std::atomic<std::uint64_t> hits_{ 0 };
+    std::atomic<std::uint64_t> misses_{ 0 };
+    std::atomic<std::uint64_t> reprepares_{ 0 };
+    std::atomic<std::uint64_t> evictions_{ 0 };
+};
+
+/**
+ * PREPAREs in flight, keyed like prepared_statement_cache.  The first query that misses the cache sends the
+ * PREPARE, queries missing on the same key while it is in flight wait for its response instead of sending their
+ * own, so a cold cache does not stampede the query service.
+ */
+template<typename Response>
+class prepare_single_flight
+{
+  public:
+    using waiter = std::function<void(const Response&)>;
+
+    enum class join_state {
+        // the caller has to send the PREPARE and hand its response to complete()
+        leader,
+        // a PREPARE of the key is in flight, the waiter runs w/ its response
+        joined,
+        // the statement has been prepared since the caller missed the cache
+        prepared,
+    };
+
+    prepare_single_flight() = default;
+    prepare_single_flight(const prepare_single_flight&) = delete;
+    prepare_single_flight& operator=(const prepare_single_flight&) = delete;
+
+    // prepared() is checked w/ the lock held, a PREPARE that completed between the caller's cache miss and
+    // join() has put its name in the cache before it was removed from here
+    template<typename Prepared>
+    join_state join(const std::string& key, waiter w, Prepared&& prepared)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (auto it = waiters_.find(key); it != waiters_.end()) {
+            it->second.emplace_back(std::move(w));
+            joined_++;
+            return join_state::joined;
+        }
+        if (prepared()) {
+            return join_state::prepared;
+        }
+        waiters_.try_emplace(key);
+        sent_++;
+        return join_state::leader;
+    }
+
+    // call once the name (if any) is in the cache, the waiters run on the calling thread outside of the lock
+    void complete(const std::string& key, const Response& resp)
+    {
+        std::vector<waiter> waiters;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = waiters_.find(key);
+            if (it == waiters_.end()) {
+                return;
+            }
+            waiters = std::move(it->second);
+            waiters_.erase(it);
+        }
+        for (auto& w : waiters) {
+            w(resp);
+        }
+    }
+
+    std::uint64_t sent() const
+    {
+        return sent_.load();
+    }
+
+    std::uint64_t joined() const
+    {
+        return joined_.load();
+    }
+
+  private:
+    std::mutex mutex_{};
+    std::unordered_map<std::string, std::vector<waiter>> waiters_{};
+    std::atomic<std::uint64_t> sent_{ 0 };
+    std::atomic<std::uint64_t> joined_{ 0 };
+};
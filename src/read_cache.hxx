@@ -0,0 +1,285 @@
+/*
+ *   Copyright 2016-2022. Couchbase, Inc.
+ *   All Rights Reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ */
+
+#pragma once
+
+#include "json_transcoder.hxx"
+#include <core/utils/binary.hxx>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Size bounded, sharded LRU of documents read through a collection.
+ *
+ * Entries are filled from GET responses on the IO threads and looked up w/ the GIL held, each shard has its
+ * own lock so neither side serializes on a single mutex.  A mutation of a key bumps the epoch of its shard, a
+ * fill that was started before the bump is dropped so a response that raced a write never repopulates the
+ * cache w/ the old document.
+ *
+ * The document (and, for JSON documents, its tape parsed on the IO thread) is immutable once cached and shared
+ * w/ the results served from it, so a hit neither copies nor parses it.
+ *
+ * Each shard keeps its share of max_bytes.  A document larger than the share (but no larger than max_bytes)
+ * is still cached, it displaces the rest of its shard and the other shards are trimmed until the total is
+ * back under max_bytes.
+ */
+class read_cache
+{
+  public:
+    using clock = std::chrono::steady_clock;
+
+    enum class lookup_state {
+        miss,
+        hit,
+        stale
+    };
+
+    struct entry {
+        std::shared_ptr<const couchbase::core::utils::binary> value;
+        // null unless the document is JSON
+        std::shared_ptr<const json_tape> tape;
+        std::uint32_t flags{ 0 };
+        std::uint64_t cas{ 0 };
+        clock::time_point expires{};
+        // accounted against max_bytes
+        std::size_t size{ 0 };
+    };
+
+    read_cache(std::size_t max_bytes, std::chrono::milliseconds ttl, bool revalidate, std::size_t num_shards = 16)
+      : max_bytes_{ max_bytes }
+      , ttl_{ ttl }
+      , revalidate_{ revalidate }
+      , shards_(num_shards)
+    {
+        shard_max_bytes_ = std::max<std::size_t>(max_bytes_ / shards_.size(), 1);
+    }
+
+    read_cache(const read_cache&) = delete;
+    read_cache& operator=(const read_cache&) = delete;
+
+    /**
+     * Copy the entry for key (it shares the cached document) into out.  The returned epoch has to be handed to
+     * put() if the caller goes on to fetch the document, stale entries are only returned when revalidation is
+     * enabled (otherwise they are dropped and reported as a miss).
+     */
+    lookup_state lookup(const std::string& key, entry& out, std::uint64_t& epoch)
+    {
+        auto& shard = shard_for(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        epoch = shard.epoch;
+        auto it = shard.index.find(key);
+        if (it == shard.index.end()) {
+            misses_++;
+            return lookup_state::miss;
+        }
+        auto node = it->second;
+        if (node->second.expires <= clock::now()) {
+            if (!revalidate_) {
+                erase(shard, it);
+                misses_++;
+                return lookup_state::miss;
+            }
+            out = node->second;
+            return lookup_state::stale;
+        }
+        shard.lru.splice(shard.lru.begin(), shard.lru, node);
+        out = node->second;
+        hits_++;
+        return lookup_state::hit;
+    }
+
+    void put(const std::string& key,
+             std::shared_ptr<const couchbase::core::utils::binary> value,
+             std::shared_ptr<const json_tape> tape,
+             std::uint32_t flags,
+             std::uint64_t cas,
+             std::uint64_t epoch)
+    {
+        auto size = key.size() + value->size() + sizeof(entry) + (tape ? tape->memory_size() : 0);
+        if (size > max_bytes_) {
+            return;
+        }
+        auto index = shard_index(key);
+        {
+            auto& shard = shards_[index];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            // the key (or one sharing its shard) was written since the lookup, the response might predate it
+            if (shard.epoch != epoch) {
+                return;
+            }
+            auto it = shard.index.find(key);
+            if (it != shard.index.end()) {
+                erase(shard, it);
+            }
+            shard.lru.emplace_front(key, entry{ std::move(value), std::move(tape), flags, cas, clock::now() + ttl_, size });
+            shard.index.emplace(key, shard.lru.begin());
+            shard.bytes += size;
+            bytes_ += size;
+            entries_++;
+            // the entry just added stays, even if it is larger than the shard's share on its own
+            while (shard.bytes > shard_max_bytes_ && shard.lru.size() > 1) {
+                evict_last(shard);
+            }
+        }
+        if (bytes_.load() > max_bytes_) {
+            trim(index);
+        }
+    }
+
+    // the server confirmed the document did not change, extend the entry by another TTL
+    bool refresh(const std::string& key, std::uint64_t cas)
+    {
+        auto& shard = shard_for(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (it == shard.index.end() || it->second->second.cas != cas) {
+            return false;
+        }
+        it->second->second.expires = clock::now() + ttl_;
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+        revalidations_++;
+        return true;
+    }
+
+    void invalidate(const std::string& key)
+    {
+        auto& shard = shard_for(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.epoch++;
+        auto it = shard.index.find(key);
+        if (it != shard.index.end()) {
+            erase(shard, it);
+        }
+    }
+
+    bool revalidate() const
+    {
+        return revalidate_;
+    }
+
+    std::size_t max_bytes() const
+    {
+        return max_bytes_;
+    }
+
+    std::chrono::milliseconds ttl() const
+    {
+        return ttl_;
+    }
+
+    std::uint64_t hits() const
+    {
+        return hits_.load();
+    }
+
+    std::uint64_t misses() const
+    {
+        return misses_.load();
+    }
+
+    std::uint64_t evictions() const
+    {
+        return evictions_.load();
+    }
+
+    std::uint64_t revalidations() const
+    {
+        return revalidations_.load();
+    }
+
+    std::size_t bytes() const
+    {
+        return bytes_.load();
+    }
+
+    std::size_t entries() const
+    {
+        return entries_.load();
+    }
+
+  private:
+    using lru_list = std::list<std::pair<std::string, entry>>;
+
+    struct cache_shard {
+        std::mutex mutex;
+        lru_list lru;
+        std::unordered_map<std::string, lru_list::iterator> index;
+        std::size_t bytes{ 0 };
+        std::uint64_t epoch{ 0 };
+    };
+
+    std::size_t shard_index(const std::string& key) const
+    {
+        return std::hash<std::string>{}(key) % shards_.size();
+    }
+
+    cache_shard& shard_for(const std::string& key)
+    {
+        return shards_[shard_index(key)];
+    }
+
+    // must be called w/ the shard locked
+    void erase(cache_shard& shard, std::unordered_map<std::string, lru_list::iterator>::iterator it)
+    {
+        auto size = it->second->second.size;
+        shard.bytes -= size;
+        bytes_ -= size;
+        entries_--;
+        shard.lru.erase(it->second);
+        shard.index.erase(it);
+    }
+
+    // must be called w/ the shard locked
+    void evict_last(cache_shard& shard)
+    {
+        erase(shard, shard.index.find(shard.lru.back().first));
+        evictions_++;
+    }
+
+    // a shard went over its share, evict from the others (one lock at a time) until the total fits again
+    void trim(std::size_t skip)
+    {
+        for (std::size_t i = 1; i < shards_.size() && bytes_.load() > max_bytes_; i++) {
+            auto& shard = shards_[(skip + i) % shards_.size()];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            while (!shard.lru.empty() && bytes_.load() > max_bytes_) {
+                evict_last(shard);
+            }
+        }
+    }
+
+    std::size_t max_bytes_;
+    std::size_t shard_max_bytes_;
+    std::chrono::milliseconds ttl_;
+    bool revalidate_;
+    std::vector<cache_shard> shards_;
+    std::atomic<std::uint64_t> hits_{ 0 };
+    std::atomic<std::uint64_t> misses_{ 0 };
+    std::atomic<std::uint64_t> evictions_{ 0 };
+    std::atomic<std::uint64_t> revalidations_{ 0 };
+    std::atomic<std::size_t> bytes_{ 0 };
+    std::atomic<std::size_t> entries_{ 0 };
+};
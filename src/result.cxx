@@ -60,25 +60,74 @@ result__get__(result* self, PyObject* args)
     }
     // PyDict_GetItem will return NULL if key doesn't exist; also suppresses errors
     PyObject* val = PyDict_GetItemString(self->dict, field_name);
+    if (val == nullptr && self->lazy != nullptr) {
+        if (-1 == self->lazy->materialize(field_name, self)) {
+            return nullptr;
+        }
+        val = PyDict_GetItemString(self->dict, field_name);
+    }
 
     if (val == nullptr && default_value == nullptr) {
         Py_RETURN_NONE;
     }
     if (val == nullptr) {
+        // borrowed from args
         val = default_value;
     }
     Py_INCREF(val);
-    if (default_value != nullptr) {
-        Py_XDECREF(default_value);
+    return val;
+}
+
+static PyObject*
+result__set__(result* self, PyObject* args)
+{
+    const char* field_name = nullptr;
+    PyObject* value = nullptr;
+
+    if (!PyArg_ParseTuple(args, "sO", &field_name, &value)) {
+        return nullptr;
+    }
+    if (self->lazy != nullptr) {
+        // keep a lazy field from overwriting the new value later on
+        if (-1 == self->lazy->materialize(field_name, self)) {
+            return nullptr;
+        }
+    }
+    if (-1 == PyDict_SetItemString(self->dict, field_name, value)) {
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject*
+result__raw_result__(result* self, [[maybe_unused]] void* closure)
+{
+    if (-1 == materialize_result_fields(self)) {
+        return nullptr;
     }
+    Py_INCREF(self->dict);
+    return self->dict;
+}
 
-    return val;
+int
+materialize_result_fields(result* res)
+{
+    if (res->lazy == nullptr) {
+        return 0;
+    }
+    auto rc = res->lazy->materialize_all(res);
+    delete res->lazy;
+    res->lazy = nullptr;
+    return rc;
 }
 
 static PyObject*
 result__str__(result* self)
 {
     const char* format_string = "result:{err=%i, err_string=%s, value=%S}";
+    if (-1 == materialize_result_fields(self)) {
+        return nullptr;
+    }
     return PyUnicode_FromFormat(format_string, self->ec.value(), self->ec.message().c_str(), self->dict);
 }
 
@@ -89,6 +138,8 @@ result_dealloc([[maybe_unused]] result* self)
         PyDict_Clear(self->dict);
         Py_DECREF(self->dict);
     }
+    Py_XDECREF(reinterpret_cast<PyObject*>(self->stream));
+    delete self->lazy;
     // CB_LOG_DEBUG("pycbc - dealloc result: result->refcnt: {}, result->dict->refcnt: {}", Py_REFCNT(self), Py_REFCNT(self->dict));
     Py_TYPE(self)->tp_free((PyObject*)self);
 }
@@ -99,6 +150,7 @@ result_new(PyTypeObject* type, PyObject*, PyObject*)
     result* self = reinterpret_cast<result*>(type->tp_alloc(type, 0));
     self->dict = PyDict_New();
     self->ec = std::error_code();
+    self->lazy = nullptr;
     return reinterpret_cast<PyObject*>(self);
 }
 
@@ -107,11 +159,12 @@ static PyMethodDef result_methods[] = {
     { "err", (PyCFunction)result__err__, METH_NOARGS, PyDoc_STR("Integer error code") },
     { "err_category", (PyCFunction)result__category__, METH_NOARGS, PyDoc_STR("error category, expressed as a string") },
     { "get", (PyCFunction)result__get__, METH_VARARGS, PyDoc_STR("get field in result object") },
+    { "set", (PyCFunction)result__set__, METH_VARARGS, PyDoc_STR("set field in result object") },
     { NULL, NULL, 0, NULL }
 };
 
-static struct PyMemberDef result_members[] = {
-    { "raw_result", T_OBJECT_EX, offsetof(result, dict), 0, PyDoc_STR("Object for the raw result data.\n") },
+static PyGetSetDef result_getset[] = {
+    { "raw_result", (getter)result__raw_result__, nullptr, PyDoc_STR("Object for the raw result data.\n"), nullptr },
     { NULL }
 };
 
@@ -132,7 +185,7 @@ pycbc_result_type_init(PyObject** ptr)
     p->tp_new = result_new;
     p->tp_dealloc = (destructor)result_dealloc;
     p->tp_methods = result_methods;
-    p->tp_members = result_members;
+    p->tp_getset = result_getset;
     p->tp_repr = (reprfunc)result__str__;
 
     return PyType_Ready(p);
@@ -234,12 +287,123 @@ create_mutation_token_obj(couchbase::mutation_token mt)
     return reinterpret_cast<PyObject*>(mut_token);
 }
 
+bool
+row_stream::on_row(std::string&& row)
+{
+    auto nbytes = row.size();
+    bool queue_flush = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (cancelled_) {
+            return false;
+        }
+        pending_.emplace_back(std::move(row));
+        buffered_rows_++;
+        buffered_bytes_ += nbytes;
+        queue_flush = !flush_queued_;
+        flush_queued_ = true;
+    }
+    if (queue_flush) {
+        conn_->completions_.push([self = shared_from_this()]() { self->flush(); });
+    }
+    if (!flow_controlled()) {
+        return true;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (above_mark(high_water_rows_, high_water_bytes_)) {
+        // stop reading the socket until the iterator caught up, the rows above are already on their way
+        resume_.wait(lock, [this]() { return cancelled_ || !above_mark(high_water_rows_ / 2 + 1, high_water_bytes_ / 2 + 1); });
+    }
+    return !cancelled_;
+}
+
+void
+row_stream::consumed(std::size_t nrows, std::size_t nbytes)
+{
+    if (!flow_controlled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    buffered_rows_ -= std::min(buffered_rows_, nrows);
+    buffered_bytes_ -= std::min(buffered_bytes_, nbytes);
+    if (!above_mark(high_water_rows_ / 2 + 1, high_water_bytes_ / 2 + 1)) {
+        resume_.notify_all();
+    }
+}
+
+void
+row_stream::cancel()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    cancelled_ = true;
+    resume_.notify_all();
+}
+
+// runs on the dispatcher w/ the GIL held
+void
+row_stream::flush()
+{
+    std::vector<std::string> batch{};
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        batch.swap(pending_);
+        flush_queued_ = false;
+        if (cancelled_) {
+            // nobody is going to read them
+            return;
+        }
+    }
+    for (auto const& row : batch) {
+        rows_->stage(PyBytes_FromStringAndSize(row.c_str(), static_cast<Py_ssize_t>(row.length())));
+    }
+    rows_->publish();
+}
+
 PyTypeObject streamed_result_type = { PyObject_HEAD_INIT(NULL) 0 };
 
+// w/ the GIL held, stops reading the response (if it streams) and drops the rows that will be queued, the
+// ones queued already are dropped by the consumer (see discard_queued())
+static void
+cancel_streamed_result(streamed_result* self)
+{
+    if (self->cancelled) {
+        return;
+    }
+    self->cancelled = true;
+    if (self->stream) {
+        self->stream->cancel();
+    }
+    if (self->rows) {
+        self->rows->close([](PyObject* row) { Py_XDECREF(row); });
+    }
+}
+
+/**
+ * Consumers on different threads take turns.  If another consumer holds the lock, it is waited for w/o the GIL,
+ * as that consumer may itself be waiting for the GIL to return its row.
+ */
+static std::unique_lock<std::mutex>
+lock_consumer(streamed_result* self)
+{
+    std::unique_lock<std::mutex> lock(self->rows->consumer_mutex(), std::try_to_lock);
+    if (!lock.owns_lock()) {
+        Py_BEGIN_ALLOW_THREADS lock.lock();
+        Py_END_ALLOW_THREADS
+    }
+    return lock;
+}
+
 static void
 streamed_result_dealloc([[maybe_unused]] streamed_result* self)
 {
     // CB_LOG_DEBUG("pycbc - dealloc streamed_result: result->refcnt: {}", Py_REFCNT(self));
+    // nobody is going to read the remaining rows, let the IO thread move on
+    cancel_streamed_result(self);
+    if (self->rows) {
+        self->rows->discard_queued();
+    }
+    self->stream.reset();
+    self->rows.reset();
     Py_TYPE(self)->tp_free((PyObject*)self);
 }
 
@@ -252,7 +416,89 @@ streamed_result_new(PyTypeObject* type, PyObject*, PyObject*)
     return reinterpret_cast<PyObject*>(self);
 }
 
-static PyMethodDef streamed_result_TABLE_methods[] = { { NULL } };
+static PyObject*
+streamed_result_fetch_many(streamed_result* self, PyObject* args, PyObject* kwargs)
+{
+    Py_ssize_t count = 0;
+    PyObject* pyObj_timeout = nullptr;
+    static const char* kw_list[] = { "count", "timeout", nullptr };
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "n|O", const_cast<char**>(kw_list), &count, &pyObj_timeout)) {
+        return nullptr;
+    }
+    if (count < 1) {
+        PyErr_SetString(PyExc_ValueError, "count must be a positive integer.");
+        return nullptr;
+    }
+    auto timeout_ms = self->timeout_ms;
+    if (pyObj_timeout != nullptr && pyObj_timeout != Py_None) {
+        // microseconds, as all timeouts passed from the Python side
+        auto timeout_us = PyLong_AsUnsignedLongLong(pyObj_timeout);
+        if (PyErr_Occurred()) {
+            return nullptr;
+        }
+        timeout_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::microseconds(timeout_us));
+    }
+
+    PyObject* pyObj_rows = PyList_New(0);
+    if (pyObj_rows == nullptr) {
+        return nullptr;
+    }
+    auto consumer = lock_consumer(self);
+    if (self->cancelled) {
+        self->rows->discard_queued();
+        return pyObj_rows;
+    }
+    // only wait (w/o the GIL) for the first row, the rest of the batch is whatever has been published already
+    PyObject* row = self->rows->poll();
+    if (row == nullptr) {
+        Py_BEGIN_ALLOW_THREADS row = self->rows->get(timeout_ms);
+        Py_END_ALLOW_THREADS
+    }
+    std::size_t nrows = 0;
+    std::size_t nbytes = 0;
+    while (row != nullptr) {
+        if (PyBytes_Check(row)) {
+            nrows++;
+            nbytes += static_cast<std::size_t>(PyBytes_GET_SIZE(row));
+        }
+        // None (end of the rows) or an error ends the batch, whatever follows is read through the iterator
+        bool last = row == Py_None || PyObject_TypeCheck(row, &exception_base_type);
+        int rc = PyList_Append(pyObj_rows, row);
+        Py_DECREF(row);
+        if (rc == -1) {
+            Py_DECREF(pyObj_rows);
+            return nullptr;
+        }
+        if (last || PyList_GET_SIZE(pyObj_rows) >= count) {
+            break;
+        }
+        row = self->rows->poll();
+    }
+    if (self->stream && nrows > 0) {
+        self->stream->consumed(nrows, nbytes);
+    }
+    // an empty list means nothing arrived within the timeout
+    return pyObj_rows;
+}
+
+static PyObject*
+streamed_result_cancel(streamed_result* self, [[maybe_unused]] PyObject* args)
+{
+    cancel_streamed_result(self);
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef streamed_result_TABLE_methods[] = {
+    { "fetch_many",
+      (PyCFunction)streamed_result_fetch_many,
+      METH_VARARGS | METH_KEYWORDS,
+      PyDoc_STR("Return a list of up to count rows, only waiting (at most timeout microseconds) for the first one") },
+    { "cancel",
+      (PyCFunction)streamed_result_cancel,
+      METH_NOARGS,
+      PyDoc_STR("Stop reading the response and drop the rows not returned yet, iteration stops right away") },
+    { NULL }
+};
 
 PyObject*
 streamed_result_iter(PyObject* self)
@@ -265,13 +511,23 @@ PyObject*
 streamed_result_iternext(PyObject* self)
 {
     streamed_result* s_res = reinterpret_cast<streamed_result*>(self);
-    PyObject* row;
-    {
+    auto consumer = lock_consumer(s_res);
+    if (s_res->cancelled) {
+        s_res->rows->discard_queued();
+        PyErr_SetString(PyExc_StopIteration, "Streaming operation has been cancelled.");
+        return nullptr;
+    }
+    // a row that is ready already does not need the GIL released
+    PyObject* row = s_res->rows->poll();
+    if (row == nullptr) {
         Py_BEGIN_ALLOW_THREADS row = s_res->rows->get(s_res->timeout_ms);
         Py_END_ALLOW_THREADS
     }
 
     if (row != nullptr) {
+        if (s_res->stream && PyBytes_Check(row)) {
+            s_res->stream->consumed(1, static_cast<std::size_t>(PyBytes_GET_SIZE(row)));
+        }
         return row;
     } else {
         PyErr_SetString(PyExc_StopIteration, "Timeout occurred waiting for next item in queue.");
@@ -310,3 +566,46 @@ create_streamed_result_obj(std::chrono::milliseconds timeout_ms)
     streamed_res->timeout_ms = timeout_ms;
     return streamed_res;
 }
+
+void
+add_multi_op_result(result* multi_result,
+                    const char* key,
+                    PyObject* pyObj_value,
+                    bool success,
+                    std::shared_ptr<std::promise<PyObject*>> barrier)
+{
+    if (multi_result->stream == nullptr) {
+        PyObject* pyObj_success = success ? Py_True : Py_False;
+        Py_INCREF(pyObj_success);
+        barrier->set_value(pyObj_success);
+        if (-1 == PyDict_SetItemString(multi_result->dict, key, pyObj_value)) {
+            // TODO:  not much we can do here...maybe?
+            PyErr_Print();
+            PyErr_Clear();
+        }
+        Py_DECREF(pyObj_value);
+        return;
+    }
+
+    // nobody waits on the barrier when streaming, but the handler still expects to settle it
+    barrier->set_value(nullptr);
+    PyObject* pyObj_row = Py_BuildValue("(sN)", key, pyObj_value);
+    if (pyObj_row == nullptr) {
+        PyErr_Print();
+        PyErr_Clear();
+    } else {
+        multi_result->stream->rows->put(pyObj_row);
+    }
+    release_multi_op_stream(multi_result);
+}
+
+void
+release_multi_op_stream(result* multi_result)
+{
+    if (--multi_result->stream_pending == 0) {
+        Py_INCREF(Py_None);
+        multi_result->stream->rows->put(Py_None);
+        // the in-flight operations held the last reference to the multi op result
+        Py_DECREF(reinterpret_cast<PyObject*>(multi_result));
+    }
+}
@@ -18,63 +18,316 @@
 #pragma once
 
 #include "client.hxx"
-#include <queue>
+#include <array>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
 #include <couchbase/mutation_token.hxx>
 
+/**
+ * Single-producer/single-consumer queue used to hand rows from a response handler to the Python iterator.
+ *
+ * Rows are written into fixed size ring segments; the producer only makes them visible to the consumer when
+ * publishing, so a handler that stages a whole page of rows pays for one release store and (at most) one
+ * wake up.  Drained segments are handed back to the producer for reuse.  The consumer spins briefly before
+ * parking on a condition variable, and the producer only touches the mutex if the consumer is parked.
+ *
+ * Calls to put()/stage()/publish() must be serialized (all producers hold the GIL), as must the consumer calls.
+ * Those wait w/o the GIL in get(), so consumers that may run on several threads (e.g. two Python threads
+ * iterating one result) take turns through consumer_mutex(), held across the wait.
+ */
 template<class T>
 class rows_queue
 {
   public:
     rows_queue()
-      : _rows()
-      , _mut()
-      , _cond()
+      : _head(new segment())
+      , _tail(_head)
     {
     }
 
     ~rows_queue()
     {
+        auto* seg = _head;
+        while (seg != nullptr) {
+            auto* next = seg->next.load(std::memory_order_relaxed);
+            delete seg;
+            seg = next;
+        }
+        delete _spare.load(std::memory_order_relaxed);
     }
 
+    rows_queue(const rows_queue&) = delete;
+    rows_queue& operator=(const rows_queue&) = delete;
+
     void put(T row)
+    {
+        stage(row);
+        publish();
+    }
+
+    // write a row w/o making it visible to the consumer yet, see publish()
+    void stage(T row)
+    {
+        if (_discard) {
+            _discard(row);
+            return;
+        }
+        if (_tail_index == segment_capacity) {
+            auto* seg = _spare.exchange(nullptr, std::memory_order_acquire);
+            if (seg == nullptr) {
+                seg = new segment();
+            }
+            // the full segment is published first, the consumer only follows next once it has drained it
+            _tail->published.store(segment_capacity, std::memory_order_release);
+            _tail->next.store(seg, std::memory_order_release);
+            _tail = seg;
+            _tail_index = 0;
+        }
+        _tail->slots[_tail_index++] = row;
+        _staged++;
+    }
+
+    // make all staged rows visible to the consumer
+    void publish()
+    {
+        if (_staged == 0) {
+            return;
+        }
+        _tail->published.store(_tail_index, std::memory_order_release);
+        _count.fetch_add(static_cast<std::int64_t>(_staged), std::memory_order_relaxed);
+        _staged = 0;
+        // pairs w/ the fence in wait_for_rows(), either the consumer sees the rows or we see it waiting
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_waiting.load(std::memory_order_relaxed)) {
+            std::function<void()> notify{};
+            {
+                std::lock_guard<std::mutex> lock(_mut);
+                _cond.notify_one();
+                if (_notify) {
+                    notify = std::move(_notify);
+                    _notify = nullptr;
+                    _waiting.store(false, std::memory_order_relaxed);
+                }
+            }
+            if (notify) {
+                notify();
+            }
+        }
+    }
+
+    /**
+     * Have the next publish() call fn, instead of parking the consumer in get().  Returns false, w/o keeping
+     * fn, if rows are available already.  Consumer side, so it must be serialized w/ get().
+     */
+    bool notify_once(std::function<void()> fn)
     {
         std::lock_guard<std::mutex> lock(_mut);
-        _rows.push(row);
-        _cond.notify_one();
+        _notify = std::move(fn);
+        _waiting.store(true, std::memory_order_relaxed);
+        // same handshake as wait_for_rows()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!has_rows()) {
+            return true;
+        }
+        _notify = nullptr;
+        _waiting.store(false, std::memory_order_relaxed);
+        return false;
     }
 
-    T get(std::chrono::milliseconds timeout_ms)
+    /**
+     * For a consumer that goes away before the end of the rows: rows put()/stage()d from now on are handed to
+     * discard, a consumer waiting in get() (or through notify_once()) is woken up.  Must be serialized w/ the
+     * producers (the GIL), may be called while another thread waits in get().
+     */
+    void close(std::function<void(T)> discard)
     {
-        std::unique_lock<std::mutex> lock(_mut);
+        _discard = std::move(discard);
+        std::function<void()> notify{};
+        {
+            std::lock_guard<std::mutex> lock(_mut);
+            _closed.store(true, std::memory_order_relaxed);
+            _cond.notify_all();
+            notify = std::move(_notify);
+            _notify = nullptr;
+            _waiting.store(false, std::memory_order_relaxed);
+        }
+        if (notify) {
+            notify();
+        }
+    }
+
+    // consumer side, after close(): hands the rows queued before closing to discard
+    void discard_queued()
+    {
+        T row{};
+        while (try_get(row)) {
+            _discard(row);
+        }
+    }
 
-        while (_rows.empty()) {
-            auto now = std::chrono::system_clock::now();
-            if (_cond.wait_until(lock, now + timeout_ms) == std::cv_status::timeout) {
+    // returns T{} (nullptr) right away if no row has been published, never blocks
+    T poll()
+    {
+        T row{};
+        try_get(row);
+        return row;
+    }
+
+    // returns T{} (nullptr) if no row has been published within timeout_ms
+    T get(std::chrono::milliseconds timeout_ms)
+    {
+        T row{};
+        if (try_get(row)) {
+            return row;
+        }
+        for (int i = 0; i < spin_count; i++) {
+            if (try_get(row)) {
+                return row;
+            }
+        }
+        auto deadline = std::chrono::steady_clock::now() + timeout_ms;
+        while (!try_get(row)) {
+            if (_closed.load(std::memory_order_relaxed) || !wait_for_rows(deadline)) {
                 // this will cause iternext to return nullptr, which stops iteration
-                return nullptr;
+                return T{};
             }
         }
-        auto row = _rows.front();
-        _rows.pop();
         return row;
     }
 
+    std::mutex& consumer_mutex()
+    {
+        return _consumer_mut;
+    }
+
+    // number of published rows not yet consumed
     int size()
     {
-        return _rows.size();
+        return static_cast<int>(std::max<std::int64_t>(_count.load(std::memory_order_relaxed), 0));
     }
 
   private:
-    std::queue<T> _rows;
-    std::mutex _mut;
-    std::condition_variable _cond;
+    static constexpr std::size_t segment_capacity = 256;
+    static constexpr int spin_count = 64;
+
+    struct segment {
+        std::array<T, segment_capacity> slots{};
+        // number of slots the consumer may read
+        std::atomic<std::size_t> published{ 0 };
+        std::atomic<segment*> next{ nullptr };
+    };
+
+    bool try_get(T& row)
+    {
+        if (_head_index == segment_capacity) {
+            auto* next = _head->next.load(std::memory_order_acquire);
+            if (next == nullptr) {
+                return false;
+            }
+            recycle(_head);
+            _head = next;
+            _head_index = 0;
+        }
+        if (_head_index == _head->published.load(std::memory_order_acquire)) {
+            return false;
+        }
+        row = _head->slots[_head_index++];
+        _count.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void recycle(segment* seg)
+    {
+        seg->published.store(0, std::memory_order_relaxed);
+        seg->next.store(nullptr, std::memory_order_relaxed);
+        delete _spare.exchange(seg, std::memory_order_release);
+    }
+
+    bool has_rows()
+    {
+        if (_head_index == segment_capacity) {
+            return _head->next.load(std::memory_order_acquire) != nullptr;
+        }
+        return _head_index != _head->published.load(std::memory_order_acquire);
+    }
+
+    // returns false if the deadline passed w/o a row being published (or the queue being closed)
+    bool wait_for_rows(std::chrono::steady_clock::time_point deadline)
+    {
+        std::unique_lock<std::mutex> lock(_mut);
+        _waiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool ready = _cond.wait_until(lock, deadline, [this]() { return has_rows() || _closed.load(std::memory_order_relaxed); });
+        _waiting.store(false, std::memory_order_relaxed);
+        return ready;
+    }
+
+    // consumer side
+    std::mutex _consumer_mut{};
+    segment* _head;
+    std::size_t _head_index{ 0 };
+    // producer side
+    segment* _tail;
+    std::size_t _tail_index{ 0 };
+    std::size_t _staged{ 0 };
+    // a drained segment, handed from the consumer back to the producer
+    std::atomic<segment*> _spare{ nullptr };
+    // may briefly go negative as rows of a full segment are visible before they are counted
+    std::atomic<std::int64_t> _count{ 0 };
+    std::atomic<bool> _waiting{ false };
+    std::mutex _mut{};
+    std::condition_variable _cond{};
+    // set by notify_once(), guarded by _mut
+    std::function<void()> _notify{};
+    // set by close(), _discard is only touched under the same serialization as the producers
+    std::atomic<bool> _closed{ false };
+    std::function<void(T)> _discard{};
 };
 
+struct streamed_result;
+class lazy_result_fields;
+
 struct result {
     PyObject_HEAD PyObject* dict;
     std::error_code ec;
+    // set when a multi op streams its results in completion order instead of collecting them in dict
+    streamed_result* stream;
+    // outstanding keys of a streaming multi op, only touched while holding the GIL
+    std::size_t stream_pending;
+    // fields that have not been added to dict yet, owned by the result
+    lazy_result_fields* lazy;
+};
+
+/**
+ * Keeps (part of) a response in its C++ form so the Python objects for its fields are only created once
+ * they are accessed, either one at a time through result.get() or all at once through result.raw_result.
+ * Only ever used w/ the GIL held.
+ */
+class lazy_result_fields
+{
+  public:
+    virtual ~lazy_result_fields() = default;
+
+    // adds the field(s) backing name to res->dict (if the response has them), returns -1 w/ a Python exception set on failure
+    virtual int materialize(const char* name, result* res) = 0;
+
+    // adds all remaining fields to res->dict, returns -1 w/ a Python exception set on failure
+    virtual int materialize_all(result* res) = 0;
 };
 
+/**
+ * Move all lazy fields into the result's dict, afterwards the dict is complete.
+ */
+int
+materialize_result_fields(result* res);
+
 int
 pycbc_result_type_init(PyObject** ptr);
 
@@ -91,10 +344,72 @@ pycbc_mutation_token_type_init(PyObject** ptr);
 PyObject*
 create_mutation_token_obj(struct couchbase::mutation_token mt);
 
+/**
+ * Rows of a streaming HTTP response (query, analytics) on their way from the socket to the Python iterator.
+ *
+ * on_row() runs on the IO thread reading the response: rows are batched there and the dispatcher moves each
+ * batch into the rows queue, w/ at most one flush queued at a time.  If a high water mark is set (rows and/or
+ * bytes, 0 disables either) and the rows buffered between the socket and the iterator reach it, on_row()
+ * waits, so nothing more is read from that socket, until the iterator consumed them down to the low water mark
+ * (half the high water mark).  That bounds memory by the window instead of the result.  As the core cannot pause
+ * a single socket, the IO thread is what waits, which is why such streams are read on a cluster (and thread) of
+ * their own, see connection::stream_cluster().
+ */
+class row_stream : public std::enable_shared_from_this<row_stream>
+{
+  public:
+    row_stream(connection* conn, std::shared_ptr<rows_queue<PyObject*>> rows, std::size_t high_water_rows, std::size_t high_water_bytes)
+      : conn_{ conn }
+      , rows_{ std::move(rows) }
+      , high_water_rows_{ high_water_rows }
+      , high_water_bytes_{ high_water_bytes }
+    {
+    }
+
+    // IO thread, returns false once the iterator is gone and the rest of the response can be skipped
+    bool on_row(std::string&& row);
+
+    // iterator (w/ the GIL held), nrows rows w/ a total of nbytes were handed to Python
+    void consumed(std::size_t nrows, std::size_t nbytes);
+
+    // iterator dropped or cancelled, unblocks a waiting on_row() and has the rest of the response skipped
+    void cancel();
+
+  private:
+    bool flow_controlled() const
+    {
+        return high_water_rows_ > 0 || high_water_bytes_ > 0;
+    }
+
+    // must be called w/ mutex_ held
+    bool above_mark(std::size_t rows_mark, std::size_t bytes_mark) const
+    {
+        return (high_water_rows_ > 0 && buffered_rows_ >= rows_mark) || (high_water_bytes_ > 0 && buffered_bytes_ >= bytes_mark);
+    }
+
+    void flush();
+
+    connection* conn_;
+    std::shared_ptr<rows_queue<PyObject*>> rows_;
+    const std::size_t high_water_rows_;
+    const std::size_t high_water_bytes_;
+    std::mutex mutex_{};
+    std::condition_variable resume_{};
+    std::vector<std::string> pending_{};
+    bool flush_queued_{ false };
+    std::size_t buffered_rows_{ 0 };
+    std::size_t buffered_bytes_{ 0 };
+    bool cancelled_{ false };
+};
+
 struct streamed_result {
     PyObject_HEAD std::error_code ec;
     std::shared_ptr<rows_queue<PyObject*>> rows;
     std::chrono::milliseconds timeout_ms{};
+    // set for responses that stream their rows, told about consumed rows so it can resume reading
+    std::shared_ptr<row_stream> stream;
+    // set once cancel() was called (or the result is deallocated), iteration stops right away
+    bool cancelled;
 };
 
 int
@@ -102,3 +417,24 @@ pycbc_streamed_result_type_init(PyObject** ptr);
 
 streamed_result*
 create_streamed_result_obj(std::chrono::milliseconds timeout_ms);
+
+/**
+ * Hand the outcome of a single key of a multi op to multi_result (steals pyObj_value).
+ *
+ * In the default mode the value is stored in the result's dict and the barrier is set to Py_True/Py_False so
+ * all_okay can be computed once every key is done.  When the multi op is streaming, a (key, value) tuple is
+ * pushed to the stream instead and the stream is terminated with None once the last key completes.
+ */
+void
+add_multi_op_result(result* multi_result,
+                    const char* key,
+                    PyObject* pyObj_value,
+                    bool success,
+                    std::shared_ptr<std::promise<PyObject*>> barrier);
+
+/**
+ * Drop one outstanding key of a streaming multi op, the stream is terminated and multi_result released
+ * once nothing is outstanding.
+ */
+void
+release_multi_op_stream(result* multi_result);
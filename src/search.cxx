@@ -555,8 +555,9 @@ create_search_result(couchbase::core::operations::search_response resp,
     } else {
         for (auto const& row : resp.rows) {
             PyObject* pyObj_row = get_result_row(row);
-            rows->put(pyObj_row);
+            rows->stage(pyObj_row);
         }
+        rows->publish();
 
         auto res = create_result_from_search_response(resp, include_metrics);
         if (res == nullptr || PyErr_Occurred() != nullptr) {
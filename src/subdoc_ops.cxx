@@ -17,10 +17,14 @@
 
 #include "subdoc_ops.hxx"
 #include "exceptions.hxx"
+#include "kv_ops.hxx"
 #include "result.hxx"
 #include <couchbase/cas.hxx>
 #include "utils.hxx"
 #include "tracing.hxx"
+#include <memory>
+#include <new>
+#include <unordered_map>
 
 couchbase::core::impl::subdoc::opcode
 to_subdoc_opcode(std::uint8_t opcode)
@@ -276,7 +280,8 @@ create_result_from_subdoc_op_response(const char* key,
                                       const T& resp,
                                       PyObject* pyObj_callback,
                                       PyObject* pyObj_errback,
-                                      std::shared_ptr<std::promise<PyObject*>> barrier)
+                                      std::shared_ptr<std::promise<PyObject*>> barrier,
+                                      result* multi_result = nullptr)
 {
     PyGILState_STATE state = PyGILState_Ensure();
     PyObject* pyObj_args = NULL;
@@ -289,7 +294,11 @@ create_result_from_subdoc_op_response(const char* key,
     if (resp.ctx.ec().value()) {
         pyObj_exc = build_exception_from_context(resp.ctx, __FILE__, __LINE__, "Subdoc operation error.");
         if (pyObj_errback == nullptr) {
-            barrier->set_value(pyObj_exc);
+            if (multi_result != nullptr) {
+                add_multi_op_result(multi_result, key, pyObj_exc, false, barrier);
+            } else {
+                barrier->set_value(pyObj_exc);
+            }
         } else {
             pyObj_func = pyObj_errback;
             pyObj_args = PyTuple_New(1);
@@ -307,7 +316,11 @@ create_result_from_subdoc_op_response(const char* key,
             set_exception = true;
         } else {
             if (pyObj_callback == nullptr) {
-                barrier->set_value(reinterpret_cast<PyObject*>(res));
+                if (multi_result != nullptr) {
+                    add_multi_op_result(multi_result, key, reinterpret_cast<PyObject*>(res), true, barrier);
+                } else {
+                    barrier->set_value(reinterpret_cast<PyObject*>(res));
+                }
             } else {
                 pyObj_func = pyObj_callback;
                 pyObj_args = PyTuple_New(1);
@@ -319,7 +332,11 @@ create_result_from_subdoc_op_response(const char* key,
     if (set_exception) {
         pyObj_exc = pycbc_build_exception(PycbcError::UnableToBuildResult, __FILE__, __LINE__, "Subdoc operation error.");
         if (pyObj_errback == nullptr) {
-            barrier->set_value(pyObj_exc);
+            if (multi_result != nullptr) {
+                add_multi_op_result(multi_result, key, pyObj_exc, false, barrier);
+            } else {
+                barrier->set_value(pyObj_exc);
+            }
         } else {
             pyObj_func = pyObj_errback;
             pyObj_args = PyTuple_New(1);
@@ -346,55 +363,57 @@ create_result_from_subdoc_op_response(const char* key,
 template<typename Request>
 void
 do_subdoc_op(connection& conn,
-             Request& req,
+             Request req,
              PyObject* pyObj_callback,
              PyObject* pyObj_errback,
-             std::shared_ptr<std::promise<PyObject*>> barrier)
+             std::shared_ptr<std::promise<PyObject*>> barrier,
+             bool is_mutation = false,
+             result* multi_result = nullptr,
+             kv_batch* batch = nullptr)
 {
     using response_type = typename Request::response_type;
-    Py_BEGIN_ALLOW_THREADS conn.cluster_->execute(req, [key = req.id.key(), pyObj_callback, pyObj_errback, barrier](response_type resp) {
-        create_result_from_subdoc_op_response(key.c_str(), resp, pyObj_callback, pyObj_errback, barrier);
-    });
+    auto handler = [key = req.id.key(), pyObj_callback, pyObj_errback, barrier, multi_result](response_type resp) {
+        create_result_from_subdoc_op_response(key.c_str(), resp, pyObj_callback, pyObj_errback, barrier, multi_result);
+    };
+    if (batch != nullptr) {
+        if (is_mutation) {
+            batch->add_mutation(conn, std::move(req), std::move(handler));
+        } else {
+            batch->add(conn, std::move(req), std::move(handler));
+        }
+        return;
+    }
+    if (is_mutation) {
+        Py_BEGIN_ALLOW_THREADS conn.execute_mutation(std::move(req), std::move(handler));
+        Py_END_ALLOW_THREADS
+        return;
+    }
+    Py_BEGIN_ALLOW_THREADS conn.execute(std::move(req), std::move(handler));
     Py_END_ALLOW_THREADS
 }
 
-PyObject*
-prepare_and_execute_lookup_in_op(struct lookup_in_options* options,
-                                 size_t nspecs,
-                                 PyObject* pyObj_callback,
-                                 PyObject* pyObj_errback,
-                                 std::shared_ptr<std::promise<PyObject*>> barrier)
+/**
+ * Parse the lookup_in spec tuples passed from Python.  Returns false, w/ the Python exception set, if one of them
+ * is invalid.
+ */
+bool
+get_lookup_in_specs(PyObject* pyObj_specs, std::vector<couchbase::core::impl::subdoc::command>& specs)
 {
-    size_t ii;
-    auto specs = std::vector<couchbase::core::impl::subdoc::command>{};
-    for (ii = 0; ii < nspecs; ++ii) {
+    auto nspecs = static_cast<size_t>(PyTuple_Check(pyObj_specs) ? PyTuple_GET_SIZE(pyObj_specs) : PyList_GET_SIZE(pyObj_specs));
+    specs.reserve(nspecs);
+    for (size_t ii = 0; ii < nspecs; ++ii) {
 
         struct lookup_in_spec new_spec = {};
         PyObject* pyObj_spec = nullptr;
-        if (PyTuple_Check(options->specs)) {
-            pyObj_spec = PyTuple_GetItem(options->specs, ii);
+        if (PyTuple_Check(pyObj_specs)) {
+            pyObj_spec = PyTuple_GetItem(pyObj_specs, ii);
         } else {
-            pyObj_spec = PyList_GetItem(options->specs, ii);
+            pyObj_spec = PyList_GetItem(pyObj_specs, ii);
         }
 
-        if (!pyObj_spec) {
+        if (!pyObj_spec || !PyArg_ParseTuple(pyObj_spec, "bsp", &new_spec.op, &new_spec.path, &new_spec.xattr)) {
             pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Unable to parse spec.");
-            if (barrier) {
-                barrier->set_value(nullptr);
-            }
-            Py_XDECREF(pyObj_callback);
-            Py_XDECREF(pyObj_errback);
-            return nullptr;
-        }
-
-        if (!PyArg_ParseTuple(pyObj_spec, "bsp", &new_spec.op, &new_spec.path, &new_spec.xattr)) {
-            pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Unable to parse spec.");
-            if (barrier) {
-                barrier->set_value(nullptr);
-            }
-            Py_XDECREF(pyObj_callback);
-            Py_XDECREF(pyObj_errback);
-            return nullptr;
+            return false;
         }
 
         try {
@@ -403,70 +422,41 @@ prepare_and_execute_lookup_in_op(struct lookup_in_options* options,
               opcode, new_spec.path, {}, couchbase::core::impl::subdoc::build_lookup_in_path_flags(new_spec.xattr) });
         } catch (const std::exception& e) {
             PyErr_SetString(PyExc_ValueError, fmt::format("Invalid subdocument opcode {}", new_spec.op).c_str());
-            if (barrier) {
-                barrier->set_value(nullptr);
-            }
-            Py_XDECREF(pyObj_callback);
-            Py_XDECREF(pyObj_errback);
-            return nullptr;
+            return false;
         }
     }
-
-    couchbase::core::operations::lookup_in_request req{ options->id };
-    req.timeout = options->timeout_ms;
-    req.access_deleted = options->access_deleted;
-    req.specs = specs;
-    if (nullptr != options->span) {
-        req.parent_span = std::make_shared<pycbc::request_span>(options->span);
-    }
-    do_subdoc_op(*(options->conn), req, pyObj_callback, pyObj_errback, barrier);
-    Py_RETURN_NONE;
+    return true;
 }
 
-PyObject*
-prepare_and_execute_mutate_in_op(struct mutate_in_options* options,
-                                 size_t nspecs,
-                                 PyObject* pyObj_callback,
-                                 PyObject* pyObj_errback,
-                                 std::shared_ptr<std::promise<PyObject*>> barrier)
+/**
+ * Parse the mutate_in spec tuples passed from Python.  Returns false, w/ the Python exception set, if one of them
+ * is invalid.
+ */
+bool
+get_mutate_in_specs(PyObject* pyObj_specs, std::vector<couchbase::core::impl::subdoc::command>& specs)
 {
-    size_t ii;
-    auto specs = std::vector<couchbase::core::impl::subdoc::command>{};
-    for (ii = 0; ii < nspecs; ++ii) {
+    auto nspecs = static_cast<size_t>(PyTuple_Check(pyObj_specs) ? PyTuple_GET_SIZE(pyObj_specs) : PyList_GET_SIZE(pyObj_specs));
+    specs.reserve(nspecs);
+    for (size_t ii = 0; ii < nspecs; ++ii) {
 
         struct mutate_in_spec new_spec = {};
         PyObject* pyObj_spec = nullptr;
-        if (PyTuple_Check(options->specs)) {
-            pyObj_spec = PyTuple_GetItem(options->specs, ii);
+        if (PyTuple_Check(pyObj_specs)) {
+            pyObj_spec = PyTuple_GetItem(pyObj_specs, ii);
         } else {
-            pyObj_spec = PyList_GetItem(options->specs, ii);
-        }
-
-        if (!pyObj_spec) {
-            pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Unable to parse spec.");
-            if (barrier) {
-                barrier->set_value(nullptr);
-            }
-            Py_XDECREF(pyObj_callback);
-            Py_XDECREF(pyObj_errback);
-            return nullptr;
+            pyObj_spec = PyList_GetItem(pyObj_specs, ii);
         }
 
-        if (!PyArg_ParseTuple(pyObj_spec,
-                              "bsppp|O",
-                              &new_spec.op,
-                              &new_spec.path,
-                              &new_spec.create_parents,
-                              &new_spec.xattr,
-                              &new_spec.expand_macros,
-                              &new_spec.pyObj_value)) {
+        if (!pyObj_spec || !PyArg_ParseTuple(pyObj_spec,
+                                             "bsppp|O",
+                                             &new_spec.op,
+                                             &new_spec.path,
+                                             &new_spec.create_parents,
+                                             &new_spec.xattr,
+                                             &new_spec.expand_macros,
+                                             &new_spec.pyObj_value)) {
             pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Unable to parse spec.");
-            if (barrier) {
-                barrier->set_value(nullptr);
-            }
-            Py_XDECREF(pyObj_callback);
-            Py_XDECREF(pyObj_errback);
-            return nullptr;
+            return false;
         }
 
         if (new_spec.pyObj_value) {
@@ -474,12 +464,7 @@ prepare_and_execute_mutate_in_op(struct mutate_in_options* options,
                 new_spec.value = PyObject_to_binary(new_spec.pyObj_value);
             } catch (const std::exception& e) {
                 pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, e.what());
-                if (barrier) {
-                    barrier->set_value(nullptr);
-                }
-                Py_XDECREF(pyObj_callback);
-                Py_XDECREF(pyObj_errback);
-                return nullptr;
+                return false;
             }
         }
 
@@ -488,22 +473,222 @@ prepare_and_execute_mutate_in_op(struct mutate_in_options* options,
             specs.emplace_back(couchbase::core::impl::subdoc::command{
               opcode,
               new_spec.path,
-              new_spec.value,
+              std::move(new_spec.value),
               couchbase::core::impl::subdoc::build_mutate_in_path_flags(new_spec.xattr, new_spec.create_parents, new_spec.expand_macros) });
         } catch (const std::exception& e) {
             PyErr_SetString(PyExc_ValueError, fmt::format("Invalid subdocument opcode {}", new_spec.op).c_str());
-            if (barrier) {
-                barrier->set_value(nullptr);
+            return false;
+        }
+    }
+    return true;
+}
+
+PyTypeObject subdoc_spec_type = { PyObject_HEAD_INIT(NULL) 0 };
+
+/**
+ * The commands of a spec list, either a compiled subdoc_spec (copied, w/ its bound values applied) or the spec
+ * tuples passed from Python.  Returns false, w/ the Python exception set, on failure.
+ */
+bool
+get_subdoc_specs(PyObject* pyObj_specs, bool is_mutation, std::vector<couchbase::core::impl::subdoc::command>& specs)
+{
+    if (!PyObject_TypeCheck(pyObj_specs, &subdoc_spec_type)) {
+        return is_mutation ? get_mutate_in_specs(pyObj_specs, specs) : get_lookup_in_specs(pyObj_specs, specs);
+    }
+    auto* compiled = reinterpret_cast<subdoc_spec*>(pyObj_specs);
+    if (compiled->is_mutation != is_mutation) {
+        pycbc_set_python_exception(PycbcError::InvalidArgument,
+                                   __FILE__,
+                                   __LINE__,
+                                   is_mutation ? "Compiled spec is not a mutate_in spec." : "Compiled spec is not a lookup_in spec.");
+        return false;
+    }
+    specs = *compiled->commands;
+    for (std::size_t ii = 0; ii < compiled->bound_values.size(); ++ii) {
+        specs[(*compiled->value_indexes)[ii]].value = compiled->bound_values[ii];
+    }
+    return true;
+}
+
+static PyObject*
+subdoc_spec_new(PyTypeObject* type, PyObject* args, PyObject* kwargs)
+{
+    PyObject* pyObj_specs = nullptr;
+    int is_mutation = 0;
+    static const char* kw_list[] = { "specs", "is_mutation", nullptr };
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|p", const_cast<char**>(kw_list), &pyObj_specs, &is_mutation)) {
+        return nullptr;
+    }
+    if ((!PyTuple_Check(pyObj_specs) && !PyList_Check(pyObj_specs)) || PyObject_Length(pyObj_specs) == 0) {
+        pycbc_set_python_exception(
+          PycbcError::InvalidArgument, __FILE__, __LINE__, "Cannot compile subdoc spec.  Need a non-empty tuple or list of specs.");
+        return nullptr;
+    }
+
+    std::vector<couchbase::core::impl::subdoc::command> commands{};
+    if (!(is_mutation ? get_mutate_in_specs(pyObj_specs, commands) : get_lookup_in_specs(pyObj_specs, commands))) {
+        return nullptr;
+    }
+    std::vector<std::size_t> value_indexes{};
+    if (is_mutation) {
+        auto nspecs = PyObject_Length(pyObj_specs);
+        for (Py_ssize_t ii = 0; ii < nspecs; ++ii) {
+            PyObject* pyObj_spec = PyTuple_Check(pyObj_specs) ? PyTuple_GET_ITEM(pyObj_specs, ii) : PyList_GET_ITEM(pyObj_specs, ii);
+            // (op, path, create_parents, xattr, expand_macros[, value])
+            if (PyTuple_GET_SIZE(pyObj_spec) > 5) {
+                value_indexes.push_back(static_cast<std::size_t>(ii));
             }
-            Py_XDECREF(pyObj_callback);
-            Py_XDECREF(pyObj_errback);
+        }
+    }
+
+    auto* self = reinterpret_cast<subdoc_spec*>(type->tp_alloc(type, 0));
+    if (self == nullptr) {
+        return nullptr;
+    }
+    new (&self->commands) std::shared_ptr<const std::vector<couchbase::core::impl::subdoc::command>>{
+        std::make_shared<const std::vector<couchbase::core::impl::subdoc::command>>(std::move(commands))
+    };
+    new (&self->value_indexes) std::shared_ptr<const std::vector<std::size_t>>{
+        std::make_shared<const std::vector<std::size_t>>(std::move(value_indexes))
+    };
+    new (&self->bound_values) std::vector<couchbase::core::utils::binary>{};
+    self->is_mutation = is_mutation != 0;
+    return reinterpret_cast<PyObject*>(self);
+}
+
+static void
+subdoc_spec_dealloc(subdoc_spec* self)
+{
+    std::destroy_at(&self->commands);
+    std::destroy_at(&self->value_indexes);
+    std::destroy_at(&self->bound_values);
+    Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
+}
+
+static PyObject*
+subdoc_spec__bind__(subdoc_spec* self, PyObject* pyObj_values)
+{
+    if (!PyTuple_Check(pyObj_values) && !PyList_Check(pyObj_values)) {
+        pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Values to bind must be a tuple or list.");
+        return nullptr;
+    }
+    auto nvalues = static_cast<std::size_t>(PyObject_Length(pyObj_values));
+    if (nvalues != self->value_indexes->size()) {
+        pycbc_set_python_exception(PycbcError::InvalidArgument,
+                                   __FILE__,
+                                   __LINE__,
+                                   fmt::format("Expected {} value(s) to bind, got {}.", self->value_indexes->size(), nvalues).c_str());
+        return nullptr;
+    }
+    std::vector<couchbase::core::utils::binary> values{};
+    values.reserve(nvalues);
+    for (std::size_t ii = 0; ii < nvalues; ++ii) {
+        auto idx = static_cast<Py_ssize_t>(ii);
+        PyObject* pyObj_value = PyTuple_Check(pyObj_values) ? PyTuple_GET_ITEM(pyObj_values, idx) : PyList_GET_ITEM(pyObj_values, idx);
+        try {
+            values.emplace_back(PyObject_to_binary(pyObj_value));
+        } catch (const std::exception& e) {
+            pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, e.what());
             return nullptr;
         }
     }
 
+    auto* bound = reinterpret_cast<subdoc_spec*>(Py_TYPE(self)->tp_alloc(Py_TYPE(self), 0));
+    if (bound == nullptr) {
+        return nullptr;
+    }
+    new (&bound->commands) std::shared_ptr<const std::vector<couchbase::core::impl::subdoc::command>>{ self->commands };
+    new (&bound->value_indexes) std::shared_ptr<const std::vector<std::size_t>>{ self->value_indexes };
+    new (&bound->bound_values) std::vector<couchbase::core::utils::binary>{ std::move(values) };
+    bound->is_mutation = self->is_mutation;
+    return reinterpret_cast<PyObject*>(bound);
+}
+
+static PyObject*
+subdoc_spec__is_mutation__(subdoc_spec* self, [[maybe_unused]] void* closure)
+{
+    return PyBool_FromLong(static_cast<long>(self->is_mutation));
+}
+
+static PyObject*
+subdoc_spec__value_count__(subdoc_spec* self, [[maybe_unused]] void* closure)
+{
+    return PyLong_FromSize_t(self->value_indexes->size());
+}
+
+static Py_ssize_t
+subdoc_spec_length(subdoc_spec* self)
+{
+    return static_cast<Py_ssize_t>(self->commands->size());
+}
+
+static PyMethodDef subdoc_spec_methods[] = {
+    { "bind", (PyCFunction)subdoc_spec__bind__, METH_O, PyDoc_STR("Copy of the spec w/ the given (encoded) values bound") },
+    { NULL, NULL, 0, NULL }
+};
+
+static PyGetSetDef subdoc_spec_getset[] = {
+    { "is_mutation", (getter)subdoc_spec__is_mutation__, nullptr, PyDoc_STR("True for a compiled mutate_in spec"), nullptr },
+    { "value_count", (getter)subdoc_spec__value_count__, nullptr, PyDoc_STR("Number of values bind() expects"), nullptr },
+    { NULL }
+};
+
+static PySequenceMethods subdoc_spec_as_sequence = { (lenfunc)subdoc_spec_length };
+
+int
+pycbc_subdoc_spec_type_init(PyObject** ptr)
+{
+    PyTypeObject* p = &subdoc_spec_type;
+
+    *ptr = (PyObject*)p;
+    if (p->tp_name) {
+        return 0;
+    }
+
+    p->tp_name = "pycbc_core.subdoc_spec";
+    p->tp_doc = "Subdocument spec list compiled for the C++ client";
+    p->tp_basicsize = sizeof(subdoc_spec);
+    p->tp_flags = Py_TPFLAGS_DEFAULT;
+    p->tp_new = subdoc_spec_new;
+    p->tp_dealloc = (destructor)subdoc_spec_dealloc;
+    p->tp_methods = subdoc_spec_methods;
+    p->tp_getset = subdoc_spec_getset;
+    p->tp_as_sequence = &subdoc_spec_as_sequence;
+
+    return PyType_Ready(p);
+}
+
+void
+prepare_and_execute_lookup_in_op(struct lookup_in_options* options,
+                                 std::vector<couchbase::core::impl::subdoc::command> specs,
+                                 PyObject* pyObj_callback,
+                                 PyObject* pyObj_errback,
+                                 std::shared_ptr<std::promise<PyObject*>> barrier,
+                                 result* multi_result = nullptr,
+                                 kv_batch* batch = nullptr)
+{
+    couchbase::core::operations::lookup_in_request req{ options->id };
+    req.timeout = options->timeout_ms;
+    req.access_deleted = options->access_deleted;
+    req.specs = std::move(specs);
+    if (nullptr != options->span) {
+        req.parent_span = std::make_shared<pycbc::request_span>(options->span);
+    }
+    do_subdoc_op(*(options->conn), std::move(req), pyObj_callback, pyObj_errback, barrier, false, multi_result, batch);
+}
+
+void
+prepare_and_execute_mutate_in_op(struct mutate_in_options* options,
+                                 std::vector<couchbase::core::impl::subdoc::command> specs,
+                                 PyObject* pyObj_callback,
+                                 PyObject* pyObj_errback,
+                                 std::shared_ptr<std::promise<PyObject*>> barrier,
+                                 result* multi_result = nullptr,
+                                 kv_batch* batch = nullptr)
+{
     couchbase::core::operations::mutate_in_request req{ options->id };
     req.cas = options->cas;
-    req.specs = specs;
+    req.specs = std::move(specs);
     req.timeout = options->timeout_ms;
     if (0 < options->expiry) {
         req.expiry = options->expiry;
@@ -517,13 +702,14 @@ prepare_and_execute_mutate_in_op(struct mutate_in_options* options,
     }
     if (options->use_legacy_durability) {
         auto req_legacy_durability =
-          couchbase::core::operations::mutate_in_request_with_legacy_durability{ req, options->persist_to, options->replicate_to };
-        do_subdoc_op(*(options->conn), req_legacy_durability, pyObj_callback, pyObj_errback, barrier);
-        Py_RETURN_NONE;
+          couchbase::core::operations::mutate_in_request_with_legacy_durability{
+            std::move(req), options->persist_to, options->replicate_to
+          };
+        do_subdoc_op(*(options->conn), std::move(req_legacy_durability), pyObj_callback, pyObj_errback, barrier, true, multi_result, batch);
+        return;
     }
     req.durability_level = options->durability_level;
-    do_subdoc_op(*(options->conn), req, pyObj_callback, pyObj_errback, barrier);
-    Py_RETURN_NONE;
+    do_subdoc_op(*(options->conn), std::move(req), pyObj_callback, pyObj_errback, barrier, true, multi_result, batch);
 }
 
 struct lookup_in_options
@@ -670,20 +856,15 @@ handle_subdoc_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kwar
         return nullptr;
     }
 
-    if (!PyTuple_Check(pyObj_spec) && !PyList_Check(pyObj_spec)) {
+    auto is_compiled = pyObj_spec != nullptr && PyObject_TypeCheck(pyObj_spec, &subdoc_spec_type);
+    if (!is_compiled && (pyObj_spec == nullptr || (!PyTuple_Check(pyObj_spec) && !PyList_Check(pyObj_spec)))) {
         pycbc_set_python_exception(
           PycbcError::InvalidArgument, __FILE__, __LINE__, "Cannot perform subdoc operation.  Value must be a tuple or list.");
         return nullptr;
     }
 
-    size_t nspecs;
-    if (PyTuple_Check(pyObj_spec)) {
-        nspecs = static_cast<size_t>(PyTuple_GET_SIZE(pyObj_spec));
-    } else {
-        nspecs = static_cast<size_t>(PyList_GET_SIZE(pyObj_spec));
-    }
-
-    if (nspecs == 0) {
+    // a compiled spec can't be empty
+    if (!is_compiled && PyObject_Length(pyObj_spec) == 0) {
         pycbc_set_python_exception(
           PycbcError::InvalidArgument, __FILE__, __LINE__, "Cannot perform subdoc operation.  Need at least one command.");
         return nullptr;
@@ -712,22 +893,33 @@ handle_subdoc_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kwar
     }
 
     switch (op_type) {
-        case Operations::LOOKUP_IN: {
-            auto opts = get_lookup_in_options(pyObj_op_args);
-            opts.conn = conn;
-            opts.id = couchbase::core::document_id{ bucket, scope, collection, key };
-            opts.op_type = op_type;
-            opts.specs = pyObj_spec;
-            prepare_and_execute_lookup_in_op(&opts, nspecs, pyObj_callback, pyObj_errback, barrier);
-            break;
-        }
+        case Operations::LOOKUP_IN:
         case Operations::MUTATE_IN: {
+            std::vector<couchbase::core::impl::subdoc::command> specs{};
+            if (!get_subdoc_specs(pyObj_spec, op_type == Operations::MUTATE_IN, specs)) {
+                if (barrier) {
+                    barrier->set_value(nullptr);
+                }
+                Py_XDECREF(pyObj_callback);
+                Py_XDECREF(pyObj_errback);
+                // the spec error is raised to the caller, also on the callback/errback path
+                return nullptr;
+            }
+            if (op_type == Operations::LOOKUP_IN) {
+                auto opts = get_lookup_in_options(pyObj_op_args);
+                opts.conn = conn;
+                opts.id = couchbase::core::document_id{ bucket, scope, collection, key };
+                opts.op_type = op_type;
+                opts.specs = pyObj_spec;
+                prepare_and_execute_lookup_in_op(&opts, std::move(specs), pyObj_callback, pyObj_errback, barrier);
+                break;
+            }
             auto opts = get_mutate_in_options(pyObj_op_args);
             opts.conn = conn;
             opts.id = couchbase::core::document_id{ bucket, scope, collection, key };
             opts.op_type = op_type;
             opts.specs = pyObj_spec;
-            prepare_and_execute_mutate_in_op(&opts, nspecs, pyObj_callback, pyObj_errback, barrier);
+            prepare_and_execute_mutate_in_op(&opts, std::move(specs), pyObj_callback, pyObj_errback, barrier);
             break;
         }
         default: {
@@ -747,3 +939,129 @@ handle_subdoc_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kwar
     }
     Py_RETURN_NONE;
 }
+
+PyObject*
+handle_subdoc_multi_op([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kwargs)
+{
+    PyObject* pyObj_conn = nullptr;
+    char* bucket = nullptr;
+    char* scope = nullptr;
+    char* collection = nullptr;
+    Operations::OperationType op_type = Operations::UNKNOWN;
+    PyObject* pyObj_op_args = nullptr;
+
+    static const char* kw_list[] = { "conn", "bucket", "scope", "collection_name", "op_type", "op_args", nullptr };
+
+    const char* kw_format = "O!sssIO";
+    int ret = PyArg_ParseTupleAndKeywords(args,
+                                          kwargs,
+                                          kw_format,
+                                          const_cast<char**>(kw_list),
+                                          &PyCapsule_Type,
+                                          &pyObj_conn,
+                                          &bucket,
+                                          &scope,
+                                          &collection,
+                                          &op_type,
+                                          &pyObj_op_args);
+    if (!ret) {
+        pycbc_set_python_exception(
+          PycbcError::InvalidArgument, __FILE__, __LINE__, "Cannot perform subdoc multi operation.  Unable to parse args/kwargs.");
+        return nullptr;
+    }
+
+    if (op_type != Operations::LOOKUP_IN && op_type != Operations::MUTATE_IN) {
+        pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Unrecognized subdoc operation passed in.");
+        return nullptr;
+    }
+
+    connection* conn = nullptr;
+    conn = reinterpret_cast<connection*>(PyCapsule_GetPointer(pyObj_conn, "conn_"));
+    if (nullptr == conn) {
+        pycbc_set_python_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, NULL_CONN_OBJECT);
+        return nullptr;
+    }
+
+    std::vector<std::future<PyObject*>> op_results{};
+    kv_batch batch{};
+    // keys usually share one spec list (e.g. the same fields read from every document), so each distinct
+    // list object is only parsed once
+    std::unordered_map<PyObject*, std::vector<couchbase::core::impl::subdoc::command>> parsed_specs{};
+
+    PyObject* pyObj_multi_result = create_result_obj();
+    result* multi_result = reinterpret_cast<result*>(pyObj_multi_result);
+
+    if (pyObj_op_args && PyDict_Check(pyObj_op_args)) {
+        PyObject *pyObj_doc_key, *pyObj_op_dict;
+        Py_ssize_t pos = 0;
+
+        // PyObj_key and pyObj_value are borrowed references
+        while (PyDict_Next(pyObj_op_args, &pos, &pyObj_doc_key, &pyObj_op_dict)) {
+            std::string k;
+            if (PyUnicode_Check(pyObj_doc_key)) {
+                k = std::string(PyUnicode_AsUTF8(pyObj_doc_key));
+            }
+            auto barrier = std::make_shared<std::promise<PyObject*>>();
+            op_results.emplace_back(barrier->get_future());
+
+            PyObject* pyObj_spec = PyDict_Check(pyObj_op_dict) ? PyDict_GetItemString(pyObj_op_dict, "spec") : nullptr;
+            if (k.empty() || pyObj_spec == nullptr ||
+                (!PyObject_TypeCheck(pyObj_spec, &subdoc_spec_type) &&
+                 (!(PyTuple_Check(pyObj_spec) || PyList_Check(pyObj_spec)) || PyObject_Length(pyObj_spec) == 0))) {
+                PyObject* pyObj_exc = pycbc_build_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Invalid key or spec.");
+                add_multi_op_result(multi_result, k.c_str(), pyObj_exc, false, barrier);
+                continue;
+            }
+
+            auto it = parsed_specs.find(pyObj_spec);
+            if (it == parsed_specs.end()) {
+                std::vector<couchbase::core::impl::subdoc::command> specs{};
+                if (!get_subdoc_specs(pyObj_spec, op_type == Operations::MUTATE_IN, specs)) {
+                    PyErr_Clear();
+                    PyObject* pyObj_exc = pycbc_build_exception(PycbcError::InvalidArgument, __FILE__, __LINE__, "Unable to parse spec.");
+                    add_multi_op_result(multi_result, k.c_str(), pyObj_exc, false, barrier);
+                    continue;
+                }
+                it = parsed_specs.emplace(pyObj_spec, std::move(specs)).first;
+            }
+
+            if (op_type == Operations::LOOKUP_IN) {
+                auto opts = get_lookup_in_options(pyObj_op_dict);
+                opts.conn = conn;
+                opts.id = couchbase::core::document_id{ bucket, scope, collection, k };
+                opts.specs = pyObj_spec;
+                prepare_and_execute_lookup_in_op(&opts, it->second, nullptr, nullptr, barrier, multi_result, &batch);
+            } else {
+                auto opts = get_mutate_in_options(pyObj_op_dict);
+                opts.conn = conn;
+                opts.id = couchbase::core::document_id{ bucket, scope, collection, k };
+                opts.specs = pyObj_spec;
+                prepare_and_execute_mutate_in_op(&opts, it->second, nullptr, nullptr, barrier, multi_result, &batch);
+            }
+        }
+    }
+
+    batch.submit();
+
+    // wait for the whole batch w/in a single GIL release, the results are only touched once the GIL is held again
+    std::vector<PyObject*> results{};
+    results.reserve(op_results.size());
+    {
+        Py_BEGIN_ALLOW_THREADS for (auto& f : op_results)
+        {
+            results.push_back(f.get());
+        }
+        Py_END_ALLOW_THREADS
+    }
+
+    auto all_okay = true;
+    for (auto* res : results) {
+        if (res == Py_False) {
+            all_okay = false;
+        }
+        Py_XDECREF(res);
+    }
+
+    PyDict_SetItemString(multi_result->dict, "all_okay", all_okay ? Py_True : Py_False);
+    return reinterpret_cast<PyObject*>(multi_result);
+}
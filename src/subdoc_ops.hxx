@@ -21,6 +21,9 @@
 #include "client.hxx"
 #include <core/impl/subdoc/opcode.hxx>
 #include <core/impl/subdoc/path_flags.hxx>
+#include <core/utils/binary.hxx>
+#include <memory>
+#include <vector>
 
 struct mutate_in_spec {
     uint8_t op;
@@ -84,7 +87,28 @@ struct mutate_in_options {
     // partition?
 };
 
+/**
+ * pycbc_core.subdoc_spec: a lookup_in or mutate_in spec list compiled once into the core's commands, so repeated
+ * operations skip parsing the spec tuples.  The object is immutable, bind() returns a new one sharing the
+ * compiled commands that only carries the values for that call, so it can be reused across calls and threads.
+ */
+struct subdoc_spec {
+    PyObject_HEAD std::shared_ptr<const std::vector<couchbase::core::impl::subdoc::command>> commands;
+    // position of each command that carries a value, bind() values are matched to them in this order
+    std::shared_ptr<const std::vector<std::size_t>> value_indexes;
+    std::vector<couchbase::core::utils::binary> bound_values;
+    bool is_mutation;
+};
+
+int
+pycbc_subdoc_spec_type_init(PyObject** ptr);
+
+extern PyTypeObject subdoc_spec_type;
+
 PyObject*
 handle_subdoc_op(PyObject* self, PyObject* args, PyObject* kwargs);
 
+PyObject*
+handle_subdoc_multi_op(PyObject* self, PyObject* args, PyObject* kwargs);
+
 #endif
@@ -16,17 +16,77 @@
  */
 
 #include "utils.hxx"
+#include <cstring>
+#include <memory>
+#include <new>
+
+namespace
+{
+/**
+ * Owns a response value and exposes it (read-only) through the buffer protocol, so a memoryview can be handed
+ * to Python w/o copying the document into a bytes object.
+ */
+struct binary_buffer {
+    PyObject_HEAD couchbase::core::utils::binary value;
+};
+
+PyTypeObject binary_buffer_type = { PyObject_HEAD_INIT(NULL) 0 };
+
+int
+binary_buffer__getbuffer__(binary_buffer* self, Py_buffer* view, int flags)
+{
+    static char empty[1] = { 0 };
+    void* buf = self->value.empty() ? empty : reinterpret_cast<void*>(self->value.data());
+    return PyBuffer_FillInfo(view, reinterpret_cast<PyObject*>(self), buf, size_t_to_py_ssize_t(self->value.size()), 1, flags);
+}
+
+void
+binary_buffer_dealloc(binary_buffer* self)
+{
+    std::destroy_at(&self->value);
+    Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
+}
+
+PyBufferProcs binary_buffer_as_buffer = { (getbufferproc)binary_buffer__getbuffer__, nullptr };
+} // namespace
+
+int
+pycbc_binary_buffer_type_init()
+{
+    PyTypeObject* p = &binary_buffer_type;
+    if (p->tp_name) {
+        return 0;
+    }
+
+    p->tp_name = "pycbc_core.binary_buffer";
+    p->tp_doc = "Read-only buffer over a document value returned by the C++ client";
+    p->tp_basicsize = sizeof(binary_buffer);
+    p->tp_flags = Py_TPFLAGS_DEFAULT;
+    p->tp_dealloc = (destructor)binary_buffer_dealloc;
+    p->tp_as_buffer = &binary_buffer_as_buffer;
+
+    return PyType_Ready(p);
+}
 
 couchbase::core::utils::binary
 PyObject_to_binary(PyObject* pyObj_value)
 {
-    char* buf;
-    Py_ssize_t nbuf;
-    if (PyBytes_AsStringAndSize(pyObj_value, &buf, &nbuf) == -1) {
+    if (PyBytes_Check(pyObj_value)) {
+        auto size = py_ssize_t_to_size_t(PyBytes_GET_SIZE(pyObj_value));
+        return couchbase::core::utils::to_binary(PyBytes_AS_STRING(pyObj_value), size);
+    }
+    // bytearray, memoryview, mmap, ... are read in place, the caller does not have to convert them to bytes
+    Py_buffer view;
+    if (PyObject_GetBuffer(pyObj_value, &view, PyBUF_SIMPLE) == -1) {
+        PyErr_Clear();
         throw std::invalid_argument("Unable to determine bytes object from provided value.");
     }
-    auto size = py_ssize_t_to_size_t(nbuf);
-    return couchbase::core::utils::to_binary(reinterpret_cast<const char*>(buf), size);
+    couchbase::core::utils::binary value(static_cast<std::size_t>(view.len));
+    if (view.len > 0) {
+        std::memcpy(value.data(), view.buf, static_cast<std::size_t>(view.len));
+    }
+    PyBuffer_Release(&view);
+    return value;
 }
 
 PyObject*
@@ -37,6 +97,20 @@ binary_to_PyObject(couchbase::core::utils::binary value)
     return PyBytes_FromStringAndSize(buf, nbuf);
 }
 
+PyObject*
+binary_to_PyMemoryView(couchbase::core::utils::binary value)
+{
+    auto* self = reinterpret_cast<binary_buffer*>(binary_buffer_type.tp_alloc(&binary_buffer_type, 0));
+    if (self == nullptr) {
+        return nullptr;
+    }
+    new (&self->value) couchbase::core::utils::binary{ std::move(value) };
+    // the memoryview keeps the buffer object (and so the value) alive
+    PyObject* pyObj_view = PyMemoryView_FromObject(reinterpret_cast<PyObject*>(self));
+    Py_DECREF(self);
+    return pyObj_view;
+}
+
 std::string
 binary_to_string(couchbase::core::utils::binary value)
 {
@@ -36,6 +36,11 @@ couchbase::core::utils::binary
 PyObject_to_binary(PyObject*);
 PyObject*
 binary_to_PyObject(couchbase::core::utils::binary value);
+// read-only memoryview that takes ownership of value (no copy), returns nullptr w/ a Python exception set on failure
+PyObject*
+binary_to_PyMemoryView(couchbase::core::utils::binary value);
+int
+pycbc_binary_buffer_type_init();
 std::string
 binary_to_string(couchbase::core::utils::binary value);
 
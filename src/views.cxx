@@ -179,8 +179,9 @@ create_view_result(couchbase::core::operations::document_view_response resp,
             }
             Py_DECREF(pyObj_tmp);
 
-            rows->put(pyObj_row);
+            rows->stage(pyObj_row);
         }
+        rows->publish();
 
         auto res = create_result_from_view_response(resp);
         if (res == nullptr || PyErr_Occurred() != nullptr) {